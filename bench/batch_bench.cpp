@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/batch.h"
+
+namespace voe {
+
+namespace {
+
+struct Timeout { int ms; };
+struct Refused { std::string host; };
+
+using Result = ValueOrError<long, Timeout, Refused>;
+
+// One error per 1000 results, the first one in the last quarter
+template <typename Results>
+Results MakeResults(size_t size) {
+  Results results;
+  results.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    if (i >= size * 3 / 4 && i % 1000 == 999) {
+      results.push_back(Result{MakeError<Timeout>(static_cast<int>(i))});
+    } else {
+      results.push_back(Result{static_cast<long>(i)});
+    }
+  }
+  return results;
+}
+
+template <typename Results>
+void BM_ScalarCountErrors(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  for (auto _ : state) {
+    size_t count = 0;
+    for (auto result : results) {
+      count += result.HasAnyError();
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_CountErrors(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountErrors(results));
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_ScalarFindFirstError(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  for (auto _ : state) {
+    size_t position = 0;
+    for (auto result : results) {
+      if (result.HasAnyError()) {
+        break;
+      }
+      ++position;
+    }
+    benchmark::DoNotOptimize(position);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_FindFirstError(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(FindFirstError(results));
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_ScalarErrorHistogram(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  for (auto _ : state) {
+    std::array<size_t, 2> histogram{};
+    for (auto result : results) {
+      if (result.HasAnyError()) {
+        ++histogram[result.GetErrorIndex()];
+      }
+    }
+    benchmark::DoNotOptimize(histogram);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_ErrorHistogram(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ErrorHistogram(results));
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_ScalarSuccessMask(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  std::vector<uint64_t> mask((results.size() + 63) / 64);
+  for (auto _ : state) {
+    std::fill(mask.begin(), mask.end(), 0);
+    size_t i = 0;
+    for (auto result : results) {
+      mask[i / 64] |= uint64_t{result.HasValue()} << (i % 64);
+      ++i;
+    }
+    benchmark::DoNotOptimize(mask.data());
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Results>
+void BM_SuccessMask(benchmark::State& state) {
+  const auto results = MakeResults<Results>(state.range(0));
+  std::vector<uint64_t> mask((results.size() + 63) / 64);
+  for (auto _ : state) {
+    SuccessMask(results, mask);
+    benchmark::DoNotOptimize(mask.data());
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+using Array = std::vector<Result>;
+using Vector = ValueOrErrorVector<long, Timeout, Refused>;
+
+}  // namespace
+
+#define VOE_BATCH_BENCHMARK(function, results, name) \
+  BENCHMARK(function<results>)->Name(name)->Arg(1 << 10)->Arg(1 << 20)
+
+VOE_BATCH_BENCHMARK(BM_ScalarCountErrors, Array, "Batch/CountErrors/Array/Scalar");
+VOE_BATCH_BENCHMARK(BM_CountErrors, Array, "Batch/CountErrors/Array/Batch");
+VOE_BATCH_BENCHMARK(BM_ScalarCountErrors, Vector, "Batch/CountErrors/Vector/Scalar");
+VOE_BATCH_BENCHMARK(BM_CountErrors, Vector, "Batch/CountErrors/Vector/Batch");
+
+VOE_BATCH_BENCHMARK(BM_ScalarFindFirstError, Array, "Batch/FindFirstError/Array/Scalar");
+VOE_BATCH_BENCHMARK(BM_FindFirstError, Array, "Batch/FindFirstError/Array/Batch");
+VOE_BATCH_BENCHMARK(BM_ScalarFindFirstError, Vector, "Batch/FindFirstError/Vector/Scalar");
+VOE_BATCH_BENCHMARK(BM_FindFirstError, Vector, "Batch/FindFirstError/Vector/Batch");
+
+VOE_BATCH_BENCHMARK(BM_ScalarErrorHistogram, Array, "Batch/ErrorHistogram/Array/Scalar");
+VOE_BATCH_BENCHMARK(BM_ErrorHistogram, Array, "Batch/ErrorHistogram/Array/Batch");
+VOE_BATCH_BENCHMARK(BM_ScalarErrorHistogram, Vector, "Batch/ErrorHistogram/Vector/Scalar");
+VOE_BATCH_BENCHMARK(BM_ErrorHistogram, Vector, "Batch/ErrorHistogram/Vector/Batch");
+
+VOE_BATCH_BENCHMARK(BM_ScalarSuccessMask, Array, "Batch/SuccessMask/Array/Scalar");
+VOE_BATCH_BENCHMARK(BM_SuccessMask, Array, "Batch/SuccessMask/Array/Batch");
+VOE_BATCH_BENCHMARK(BM_ScalarSuccessMask, Vector, "Batch/SuccessMask/Vector/Scalar");
+VOE_BATCH_BENCHMARK(BM_SuccessMask, Vector, "Batch/SuccessMask/Vector/Batch");
+
+#undef VOE_BATCH_BENCHMARK
+
+}  // namespace voe
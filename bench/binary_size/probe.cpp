@@ -0,0 +1,132 @@
+// One cell of the binary-size benchmark: instantiates the operation VOE_SIZE_OP for entry
+// VOE_SIZE_INDEX of its type list. Without VOE_SIZE_OP only the headers are compiled, which is
+// the baseline subtracted from every cell. With VOE_SIZE_LEGEND it is an executable printing
+// the entries of the type lists.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "voe_tools.h"
+
+namespace voe_size {
+
+struct Payload { std::string text; };
+struct Code { int value; };
+struct Message { std::string text; };
+
+using Instantiations = test::Types<Payload, Code, Message>;
+using Conversions = test::AllConvertiblePairs<Payload, Code, Message>;
+
+template <size_t Index, typename List>
+struct AtHolder;
+
+template <size_t Index, typename... Types>
+struct AtHolder<Index, test::Ts<Types...>> {
+  using type = std::tuple_element_t<Index, std::tuple<Types...>>;
+};
+
+template <size_t Index, typename List>
+using At = typename AtHolder<Index, List>::type;
+
+template <typename List>
+static constexpr size_t Size = 0;
+
+template <typename... Types>
+static constexpr size_t Size<test::Ts<Types...>> = sizeof...(Types);
+
+template <typename Voe>
+struct Lifetime {
+  static void Run(Voe& lhs, Voe& rhs) {
+    Voe copy = lhs;
+    Voe moved = std::move(rhs);
+    lhs = copy;
+    rhs = std::move(moved);
+  }
+};
+
+template <typename Voe>
+struct Visit {
+  static size_t Run(const Voe& voe) {
+    return voe.Visit([](const auto&... alternative) { return sizeof...(alternative); });
+  }
+};
+
+template <typename Voe>
+struct Transform {
+  static auto Run(Voe&& voe) {
+    return std::move(voe).Transform([](auto&&... value) { return sizeof...(value); });
+  }
+};
+
+template <typename Voe>
+struct All {
+  static size_t Run(Voe& lhs, Voe& rhs) {
+    Lifetime<Voe>::Run(lhs, rhs);
+    return Visit<Voe>::Run(lhs) + Transform<Voe>::Run(std::move(rhs)).HasAnyError();
+  }
+};
+
+template <typename Conversion>
+struct Convert;
+
+template <typename From, typename To>
+struct Convert<test::Pair<From, To>> {
+  static To Run(const From& from, From&& moved, To& to) {
+    To copy = from;
+    to = std::move(moved);
+    return copy;
+  }
+};
+
+#if defined(VOE_SIZE_OP)
+
+static_assert(
+    Size<Instantiations> == VOE_SIZE_INSTANTIATIONS && Size<Conversions> == VOE_SIZE_CONVERSIONS,
+    "update the matrix sizes in bench/binary_size/CMakeLists.txt");
+
+template struct VOE_SIZE_OP<At<VOE_SIZE_INDEX, VOE_SIZE_LIST>>;
+
+#elif defined(VOE_SIZE_LEGEND)
+
+template <typename Type>
+constexpr std::string_view TypeName() {
+  // "... [with Type = <name>; ...]" for GCC, "... [Type = <name>]" for Clang
+  std::string_view name = __PRETTY_FUNCTION__;
+  name.remove_prefix(name.find("Type = ") + 7);
+  return name.substr(0, std::min(name.find(';'), name.rfind(']')));
+}
+
+template <typename... Types>
+void PrintInstantiations(test::Ts<Types...>) {
+  size_t index = 0;
+  (..., std::printf("  [%zu] %.*s\n", index++,
+        static_cast<int>(TypeName<Types>().size()), TypeName<Types>().data()));
+}
+
+template <typename... Froms, typename... Tos>
+void PrintConversions(test::Ts<test::Pair<Froms, Tos>...>) {
+  size_t index = 0;
+  (..., std::printf("  [%zu] %.*s -> %.*s\n", index++,
+        static_cast<int>(TypeName<Froms>().size()), TypeName<Froms>().data(),
+        static_cast<int>(TypeName<Tos>().size()), TypeName<Tos>().data()));
+}
+
+#endif
+
+}  // namespace voe_size
+
+#if defined(VOE_SIZE_LEGEND)
+
+int main() {
+  std::printf("Instantiations (Lifetime, Visit, Transform, All):\n");
+  voe_size::PrintInstantiations(voe_size::Instantiations{});
+  std::printf("Conversions (Convert):\n");
+  voe_size::PrintConversions(voe_size::Conversions{});
+}
+
+#endif
@@ -0,0 +1,74 @@
+# Prints the .text and .rodata bytes of each binary-size cell over the baseline object.
+# Invoked by the value_or_error_size_bench target with VOE_SIZE_TOOL and VOE_SIZE_OBJECTS.
+
+function(voe_object_sizes object text_var rodata_var)
+  execute_process(
+    COMMAND ${VOE_SIZE_TOOL} -A ${object}
+    OUTPUT_VARIABLE output
+    COMMAND_ERROR_IS_FATAL ANY
+  )
+  set(text 0)
+  set(rodata 0)
+  string(REGEX MATCHALL "\n\\.[^ \n]+ +[0-9]+" sections "${output}")
+  foreach(section ${sections})
+    string(REGEX REPLACE "^\n([^ ]+) +([0-9]+)$" "\\1" name "${section}")
+    string(REGEX REPLACE "^\n([^ ]+) +([0-9]+)$" "\\2" bytes "${section}")
+    if(name MATCHES "^\\.text")
+      math(EXPR text "${text} + ${bytes}")
+    elseif(name MATCHES "^\\.(rodata|data\\.rel\\.ro)")
+      math(EXPR rodata "${rodata} + ${bytes}")
+    endif()
+  endforeach()
+  set(${text_var} ${text} PARENT_SCOPE)
+  set(${rodata_var} ${rodata} PARENT_SCOPE)
+endfunction()
+
+function(voe_pad value width out_var)
+  string(LENGTH "${value}" length)
+  math(EXPR padding "${width} - ${length}")
+  if(padding GREATER 0)
+    string(REPEAT " " ${padding} spaces)
+    set(value "${spaces}${value}")
+  endif()
+  set(${out_var} "${value}" PARENT_SCOPE)
+endfunction()
+
+set(cells "")
+foreach(object ${VOE_SIZE_OBJECTS})
+  get_filename_component(name ${object} NAME)
+  if(name MATCHES "^probe\\.")
+    voe_object_sizes(${object} baseline_text baseline_rodata)
+  elseif(name MATCHES "^([A-Za-z]+)_([0-9]+)\\.")
+    list(APPEND cells "${CMAKE_MATCH_1}[${CMAKE_MATCH_2}]=${object}")
+  endif()
+endforeach()
+
+message("Bytes over the baseline (${baseline_text} .text, ${baseline_rodata} .rodata):")
+message("  cell                 .text   .rodata")
+foreach(cell ${cells})
+  string(REGEX REPLACE "=.*$" "" label "${cell}")
+  string(REGEX REPLACE "^[^=]*=" "" object "${cell}")
+  string(REGEX REPLACE "\\[.*$" "" op "${label}")
+  voe_object_sizes(${object} text rodata)
+  math(EXPR text "${text} - ${baseline_text}")
+  math(EXPR rodata "${rodata} - ${baseline_rodata}")
+  math(EXPR total_text_${op} "0${total_text_${op}} + ${text}")
+  math(EXPR total_rodata_${op} "0${total_rodata_${op}} + ${rodata}")
+  list(APPEND ops ${op})
+
+  string(APPEND label "                    ")
+  string(SUBSTRING "${label}" 0 16 label)
+  voe_pad(${text} 10 text)
+  voe_pad(${rodata} 10 rodata)
+  message("  ${label}${text}${rodata}")
+endforeach()
+
+list(REMOVE_DUPLICATES ops)
+message("Totals per operation:")
+foreach(op ${ops})
+  set(label "${op}                    ")
+  string(SUBSTRING "${label}" 0 16 label)
+  voe_pad(${total_text_${op}} 10 text)
+  voe_pad(${total_rodata_${op}} 10 rodata)
+  message("  ${label}${text}${rodata}")
+endforeach()
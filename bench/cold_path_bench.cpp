@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+
+namespace voe {
+
+namespace {
+
+template <int Index>
+struct Error { std::string message; };
+
+// Sixteen non-trivial errors, none of which occurs in the benchmarks
+using Result = ValueOrError<
+  long,
+  Error<0>, Error<1>, Error<2>, Error<3>, Error<4>, Error<5>, Error<6>, Error<7>,
+  Error<8>, Error<9>, Error<10>, Error<11>, Error<12>, Error<13>, Error<14>, Error<15>>;
+
+using Status = VoidOrError<Error<3>>;
+
+[[gnu::noinline]] Result Parse(int x) {
+  switch (x) {
+    case -1: return MakeError<Error<0>>("negative input");
+    case -2: return MakeError<Error<7>>("unsupported input");
+    case -3: return MakeError<Error<15>>("malformed input");
+    default: return long{x};
+  }
+}
+
+[[gnu::noinline]] Status Check(long x) {
+  if (x < 0) {
+    return MakeError<Error<3>>("negative value");
+  }
+  return {};
+}
+
+Result Process(int x) {
+  long value = 0;
+  ASSIGN_OR_RETURN_ERROR(value, Parse(x));
+  RETURN_IF_ERROR(Check(value));
+  Result result = value;
+  Result copy = result;
+  result = std::move(copy);
+  return result;
+}
+
+void BM_HappyPath(benchmark::State& state) {
+  std::vector<int> inputs(4096);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = static_cast<int>(i);
+  }
+  for (auto _ : state) {
+    for (int input : inputs) {
+      auto result = Process(input);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_HappyPath)->Name("ColdPath/HappyPath");
+
+}  // namespace voe
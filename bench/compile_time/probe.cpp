@@ -0,0 +1,45 @@
+// Runs a command and reports its wall time and peak resident memory.
+// Usage: value_or_error_compile_probe <label> <command> [args...]
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "usage: %s <label> <command> [args...]\n", argv[0]);
+    return 2;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const pid_t pid = fork();
+  if (pid < 0) {
+    std::perror("fork");
+    return 2;
+  }
+  if (pid == 0) {
+    execvp(argv[2], argv + 2);
+    std::perror("execvp");
+    _exit(127);
+  }
+
+  int status = 0;
+  rusage usage{};
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    std::perror("wait4");
+    return 2;
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+#if defined(__APPLE__)
+  const double peak_mib = usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  const double peak_mib = usage.ru_maxrss / 1024.0;
+#endif
+
+  std::printf("%-24s %8.2f s %10.1f MiB\n", argv[1], elapsed.count(), peak_mib);
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
@@ -0,0 +1,80 @@
+// Compiled once per VOE_CONTRACT_MODE, see CMakeLists.txt.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+
+namespace voe {
+
+namespace {
+
+struct ParseError { std::string message; };
+struct RangeError { std::string message; };
+
+using Number = ValueOrError<int, ParseError, RangeError>;
+using Text = ValueOrError<std::string, ParseError, RangeError>;
+
+std::vector<Number> MakeNumbers() {
+  std::vector<Number> numbers;
+  for (int i = 0; i < 4096; ++i) {
+    numbers.push_back(i);
+  }
+  return numbers;
+}
+
+// The caller knows that every result holds a value
+void BM_GetValue(benchmark::State& state) {
+  const auto numbers = MakeNumbers();
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& number : numbers) {
+      sum += number.GetValue();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+
+// The check of GetValue() duplicates the one of HasValue()
+void BM_HasValueGetValue(benchmark::State& state) {
+  const auto numbers = MakeNumbers();
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& number : numbers) {
+      if (number.HasValue()) {
+        sum += number.GetValue();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * numbers.size());
+}
+
+// After GetValue() the destructor may destroy the value without dispatching on the index
+[[gnu::noinline]] size_t Consume(Text& text) {
+  Text local = std::move(text);
+  return local.GetValue().size();
+}
+
+void BM_ConsumeValue(benchmark::State& state) {
+  std::vector<Text> texts(4096, Text(std::string("value")));
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (auto& text : texts) {
+      sum += Consume(text);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * texts.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_GetValue)->Name("Contract/GetValue");
+BENCHMARK(BM_HasValueGetValue)->Name("Contract/HasValueGetValue");
+BENCHMARK(BM_ConsumeValue)->Name("Contract/ConsumeValue");
+
+}  // namespace voe
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/batch.h"
+
+namespace voe {
+
+namespace {
+
+struct NotFound { long key; };
+struct Timeout { int ms; };
+struct Refused { std::string host; };
+
+using Narrow = ValueOrError<long, NotFound, Timeout>;
+using Wide = ValueOrError<long, Refused, Timeout, NotFound>;
+using TrivialWide = ValueOrError<long, Timeout, NotFound>;
+
+constexpr size_t kSize = 1 << 16;
+
+template <typename Results>
+Results MakeResults(int error_percent) {
+  Results results;
+  results.reserve(kSize);
+  uint32_t state = 12345;
+  for (size_t i = 0; i < kSize; ++i) {
+    state = state * 1664525 + 1013904223;
+    if (static_cast<int>((state >> 8) % 100) >= error_percent) {
+      results.push_back(Narrow{static_cast<long>(i)});
+    } else if (state % 2 == 0) {
+      results.push_back(Narrow{MakeError<NotFound>(static_cast<long>(i))});
+    } else {
+      results.push_back(Narrow{MakeError<Timeout>(static_cast<int>(i))});
+    }
+  }
+  return results;
+}
+
+template <typename To>
+void BM_ConvertEach(benchmark::State& state) {
+  const auto src = MakeResults<std::vector<Narrow>>(static_cast<int>(state.range(0)));
+  std::vector<To> dst(src.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < src.size(); ++i) {
+      dst[i] = src[i];
+    }
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename To>
+void BM_ConvertAll(benchmark::State& state) {
+  const auto src = MakeResults<std::vector<Narrow>>(static_cast<int>(state.range(0)));
+  std::vector<To> dst(src.size());
+  for (auto _ : state) {
+    ConvertAll(src, dst);
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+// Builds the converted vector the way it is done without the converting constructor
+void BM_ConvertVectorEach(benchmark::State& state) {
+  const auto src = MakeResults<std::vector<Narrow>>(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    ValueOrErrorVector<long, Refused, Timeout, NotFound> dst;
+    dst.reserve(src.size());
+    for (const auto& result : src) {
+      dst.push_back(result);
+    }
+    benchmark::DoNotOptimize(dst.Indices().data());
+  }
+  state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+void BM_ConvertVector(benchmark::State& state) {
+  using From = ValueOrErrorVector<long, NotFound, Timeout>;
+  const auto src = MakeResults<From>(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    const ValueOrErrorVector<long, Refused, Timeout, NotFound> dst(src);
+    benchmark::DoNotOptimize(dst.Indices().data());
+  }
+  state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+}  // namespace
+
+#define VOE_CONVERT_BENCHMARK(function, name) \
+  BENCHMARK(function)->Name(name)->Arg(1)->Arg(10)->Arg(50)
+
+VOE_CONVERT_BENCHMARK(BM_ConvertEach<TrivialWide>, "ConvertAll/Trivial/Each");
+VOE_CONVERT_BENCHMARK(BM_ConvertAll<TrivialWide>, "ConvertAll/Trivial/ConvertAll");
+VOE_CONVERT_BENCHMARK(BM_ConvertEach<Wide>, "ConvertAll/NonTrivial/Each");
+VOE_CONVERT_BENCHMARK(BM_ConvertAll<Wide>, "ConvertAll/NonTrivial/ConvertAll");
+VOE_CONVERT_BENCHMARK(BM_ConvertVectorEach, "ConvertAll/Vector/Each");
+VOE_CONVERT_BENCHMARK(BM_ConvertVector, "ConvertAll/Vector/Converting");
+
+#undef VOE_CONVERT_BENCHMARK
+
+}  // namespace voe
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/error_list.h"
+
+namespace voe {
+
+namespace {
+
+struct EmptyName {};
+struct BadEmail { size_t position; };
+struct TooYoung { int age; };
+
+struct User {
+  std::string name;
+  std::string email;
+  int age;
+};
+
+VoidOrError<EmptyName> CheckName(const User& user) {
+  if (user.name.empty()) {
+    return MakeError<EmptyName>();
+  }
+  return {};
+}
+
+VoidOrError<BadEmail> CheckEmail(const User& user) {
+  if (user.email.find('@') == std::string::npos) {
+    return MakeError<BadEmail>(user.email.size());
+  }
+  return {};
+}
+
+VoidOrError<TooYoung> CheckAge(const User& user) {
+  if (user.age < 18) {
+    return MakeError<TooYoung>(user.age);
+  }
+  return {};
+}
+
+// The users failing 0, 1 and 3 of the checks
+std::vector<User> MakeUsers(int failures) {
+  User user{"name", "user@host", 30};
+  if (failures >= 1) {
+    user.age = 10;
+  }
+  if (failures >= 3) {
+    user.name.clear();
+    user.email = "user";
+  }
+  return std::vector<User>(1024, user);
+}
+
+using Status = VoidOrError<EmptyName, BadEmail, TooYoung>;
+
+// The accumulation the ErrorList replaces
+void BM_Vector(benchmark::State& state) {
+  const auto users = MakeUsers(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (const User& user : users) {
+      std::vector<Status> errors;
+      for (Status status : {Status(CheckName(user)), Status(CheckEmail(user)),
+                            Status(CheckAge(user))}) {
+        if (status.HasAnyError()) {
+          errors.push_back(std::move(status));
+        }
+      }
+      benchmark::DoNotOptimize(errors);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * users.size());
+}
+
+void BM_CheckAll(benchmark::State& state) {
+  const auto users = MakeUsers(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (const User& user : users) {
+      auto result = CheckAll(std::cref(user), CheckName, CheckEmail, CheckAge);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * users.size());
+}
+
+void BM_CollectErrors(benchmark::State& state) {
+  const auto users = MakeUsers(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (const User& user : users) {
+      auto errors = CollectErrors(CheckName(user), CheckEmail(user), CheckAge(user));
+      benchmark::DoNotOptimize(errors);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * users.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Vector)->Name("ErrorList/Vector")->Arg(0)->Arg(1)->Arg(3);
+BENCHMARK(BM_CheckAll)->Name("ErrorList/CheckAll")->Arg(0)->Arg(1)->Arg(3);
+BENCHMARK(BM_CollectErrors)->Name("ErrorList/CollectErrors")->Arg(0)->Arg(1)->Arg(3);
+
+}  // namespace voe
@@ -0,0 +1,25 @@
+// Error types shared by the translation units of the instantiation benchmark.
+
+#ifndef VOE_BENCH_INSTANTIATION_ERRORS
+#define VOE_BENCH_INSTANTIATION_ERRORS
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+
+struct IoError { int code; };
+struct ParseError { std::string message; size_t offset; };
+struct LimitError { size_t limit; };
+
+using Document = voe::ValueOrError<std::vector<std::string>, IoError, ParseError, LimitError>;
+using Line = voe::ValueOrError<std::string, IoError, ParseError>;
+using Status = voe::VoidOrError<IoError, ParseError, LimitError>;
+
+#ifdef VOE_BENCH_EXTERN_TEMPLATES
+VOE_EXTERN_TEMPLATE(std::vector<std::string>, IoError, ParseError, LimitError);
+VOE_EXTERN_TEMPLATE(std::string, IoError, ParseError);
+VOE_EXTERN_TEMPLATE(void, IoError, ParseError, LimitError);
+#endif
+
+#endif  // VOE_BENCH_INSTANTIATION_ERRORS
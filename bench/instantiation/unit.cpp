@@ -0,0 +1,45 @@
+// A translation unit of the instantiation benchmark, compiled VOE_BENCH_UNITS times with
+// a different VOE_BENCH_UNIT namespace.
+
+#include "errors.h"
+
+namespace VOE_BENCH_UNIT {
+
+Line ReadLine(const std::string& input, size_t offset) {
+  if (offset > input.size()) {
+    return voe::MakeError<IoError>(static_cast<int>(offset));
+  }
+  const size_t end = input.find('\n', offset);
+  if (end == std::string::npos) {
+    return voe::MakeError<ParseError>("unterminated line", offset);
+  }
+  return input.substr(offset, end - offset);
+}
+
+Document ReadDocument(const std::string& input, size_t max_lines) {
+  std::vector<std::string> lines;
+  for (size_t offset = 0; offset < input.size();) {
+    if (lines.size() == max_lines) {
+      return voe::MakeError<LimitError>(max_lines);
+    }
+    Line line = ReadLine(input, offset);
+    if (line.HasAnyError()) {
+      return std::move(line).DiscardValue();
+    }
+    offset += line.GetValue().size() + 1;
+    lines.push_back(std::move(line).GetValue());
+  }
+  return lines;
+}
+
+Status Validate(const std::string& input) {
+  Document document = ReadDocument(input, 64);
+  Document copy = document;
+  document = Line(voe::MakeError<IoError>(0)).DiscardValue();
+  if (copy.HasAnyError()) {
+    return std::move(copy).DiscardValue();
+  }
+  return {};
+}
+
+}  // namespace VOE_BENCH_UNIT
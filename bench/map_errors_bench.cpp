@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+
+namespace voe {
+
+namespace {
+
+struct DiskError { int code; };
+struct NetworkError { int code; };
+struct TimeoutError { std::string message; };
+
+struct ServiceError { int code; };
+
+using Lower = ValueOrError<int, DiskError, NetworkError, TimeoutError>;
+using Upper = ValueOrError<int, ServiceError, TimeoutError>;
+
+struct ToServiceError {
+  static ServiceError Translate(DiskError e) { return {e.code}; }
+  static ServiceError Translate(NetworkError e) { return {-e.code}; }
+};
+
+[[gnu::noinline]] Lower Load(int x) {
+  switch (x % 4) {
+    case 0: return MakeError<DiskError>(x);
+    case 1: return MakeError<NetworkError>(x);
+    case 2: return MakeError<TimeoutError>("timed out while waiting for the response");
+    default: return x;
+  }
+}
+
+Upper Visited(int x) {
+  Lower lower = Load(x);
+  if (lower.HasValue()) {
+    return lower.GetValue();
+  }
+  return std::move(lower).Visit([](auto&& error) -> Upper {
+    using Type = std::remove_cvref_t<decltype(error)>;
+    if constexpr (std::is_same_v<Type, TimeoutError>) {
+      return MakeError<TimeoutError>(std::move(error));
+    } else if constexpr (std::is_same_v<Type, int>) {
+      return error;
+    } else {
+      return MakeError<ServiceError>(ToServiceError::Translate(error));
+    }
+  });
+}
+
+Upper Mapped(int x) {
+  return Load(x).MapErrors<ToServiceError>();
+}
+
+template <Upper (*Function)(int)>
+void BM_Translate(benchmark::State& state) {
+  // The argument is the percentage of the inputs failing, with each of the three errors in turn
+  std::vector<int> inputs(1024);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = i % 100 < static_cast<size_t>(state.range(0)) ? static_cast<int>(i % 3) : 3;
+  }
+  for (auto _ : state) {
+    for (int input : inputs) {
+      auto result = Function(input);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Translate<Visited>)->Name("Translate/Visit")->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(BM_Translate<Mapped>)->Name("Translate/MapErrors")->Arg(0)->Arg(10)->Arg(50);
+
+}  // namespace voe
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+
+namespace voe {
+
+namespace {
+
+struct ParseError { std::string message; };
+struct RangeError { std::string message; };
+struct OverflowError { std::string message; };
+
+using Result = ValueOrError<long, ParseError, RangeError, OverflowError>;
+
+[[gnu::noinline]] ValueOrError<int, ParseError> Parse(int x) {
+  if (x < 0) {
+    return MakeError<ParseError>("negative input cannot be parsed as a valid number");
+  }
+  return x;
+}
+
+[[gnu::noinline]] ValueOrError<int, ParseError, RangeError> Validate(int x) {
+  if (x % 100 == 1) {
+    return MakeError<RangeError>("input is outside of the range accepted by validation");
+  }
+  return x + 1;
+}
+
+[[gnu::noinline]] ValueOrError<long, OverflowError> Scale(int x) {
+  if (x % 100 == 3) {
+    return MakeError<OverflowError>("scaled input does not fit into the result type");
+  }
+  return 2l * x;
+}
+
+Result Manual(int x) {
+  auto parsed = Parse(x);
+  if (parsed.HasAnyError()) {
+    return parsed.DiscardValue();
+  }
+  auto validated = Validate(parsed.GetValue());
+  if (validated.HasAnyError()) {
+    return validated.DiscardValue();
+  }
+  return Scale(validated.GetValue());
+}
+
+Result Monadic(int x) {
+  return Parse(x).AndThen(Validate).AndThen(Scale);
+}
+
+std::vector<int> MakeInputs(int error_percent) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<int> value(0, 1'000'000);
+
+  std::vector<int> inputs(4096);
+  for (auto& input : inputs) {
+    const int kind = percent(gen) < error_percent ? percent(gen) % 3 : -1;
+    input = value(gen) / 100 * 100;
+    switch (kind) {
+      case 0: input = -input - 1; break;
+      case 1: input += 1; break;
+      case 2: input += 2; break;
+      default: input += 10; break;
+    }
+  }
+  return inputs;
+}
+
+template <Result (*Function)(int)>
+void BM_Chain(benchmark::State& state) {
+  const auto inputs = MakeInputs(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    for (int input : inputs) {
+      auto result = Function(input);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Chain<Manual>)->Name("Chain/Manual")->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(BM_Chain<Monadic>)->Name("Chain/Monadic")->Arg(0)->Arg(10)->Arg(50);
+
+}  // namespace voe
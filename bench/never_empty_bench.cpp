@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+
+namespace voe {
+
+namespace {
+
+struct Code { int value; };
+
+struct Name { std::string text; };
+struct NeverEmptyName { std::string text; };
+
+}  // namespace
+
+template <>
+struct NeverEmptyTraits<NeverEmptyName> : public std::true_type {};
+
+namespace {
+
+template <typename Value>
+std::vector<ValueOrError<Value, Code>> MakeResults() {
+  std::vector<ValueOrError<Value, Code>> results;
+  for (int i = 0; i < 4096; ++i) {
+    if (i % 10 == 0) {
+      results.push_back(MakeError<Code>(i));
+    } else {
+      results.push_back(Value{"short"});
+    }
+  }
+  return results;
+}
+
+template <typename Value>
+void BM_CopyAndDestroy(benchmark::State& state) {
+  const auto results = MakeResults<Value>();
+  for (auto _ : state) {
+    for (const auto& result : results) {
+      ValueOrError<Value, Code> copy = result;
+      benchmark::DoNotOptimize(copy);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+template <typename Value>
+void BM_Assign(benchmark::State& state) {
+  const auto results = MakeResults<Value>();
+  ValueOrError<Value, Code> target = results[1];
+  for (auto _ : state) {
+    for (const auto& result : results) {
+      target = result;
+      benchmark::DoNotOptimize(target);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_CopyAndDestroy<Name>)->Name("NeverEmpty/CopyAndDestroy/Default");
+BENCHMARK(BM_CopyAndDestroy<NeverEmptyName>)->Name("NeverEmpty/CopyAndDestroy/NeverEmpty");
+BENCHMARK(BM_Assign<Name>)->Name("NeverEmpty/Assign/Default");
+BENCHMARK(BM_Assign<NeverEmptyName>)->Name("NeverEmpty/Assign/NeverEmpty");
+
+}  // namespace voe
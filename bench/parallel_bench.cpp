@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/parallel.h"
+
+namespace voe {
+
+namespace {
+
+struct Corrupted { uint64_t hash; };
+struct Unauthorized {};
+
+using Result = ValueOrError<uint64_t, Corrupted, Unauthorized>;
+
+constexpr size_t kSize = 1 << 16;
+
+// About a microsecond of work per input
+uint64_t Hash(uint64_t input) {
+  for (int round = 0; round < 256; ++round) {
+    input ^= input >> 33;
+    input *= 0xff51afd7ed558ccdULL;
+  }
+  return input;
+}
+
+// The inputs from the fatal_input on are unauthorized
+auto MakeTransform(uint64_t fatal_input) {
+  return [fatal_input](uint64_t input) -> Result {
+    const uint64_t hash = Hash(input);
+    if (input >= fatal_input) {
+      return MakeError<Unauthorized>();
+    }
+    if (hash % 97 == 0) {
+      return MakeError<Corrupted>(hash);
+    }
+    return hash;
+  };
+}
+
+std::vector<uint64_t> MakeInputs() {
+  std::vector<uint64_t> inputs(kSize);
+  std::iota(inputs.begin(), inputs.end(), uint64_t{0});
+  return inputs;
+}
+
+void BM_Sequential(benchmark::State& state) {
+  const auto inputs = MakeInputs();
+  const auto transform = MakeTransform(kSize);
+  for (auto _ : state) {
+    std::vector<Result> results(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      results[i] = transform(inputs[i]);
+    }
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+void BM_Parallel(benchmark::State& state) {
+  const auto inputs = MakeInputs();
+  const ParallelPolicy<Unauthorized> policy{.threads = static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto results = ParallelTransform(inputs, MakeTransform(kSize), policy);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+// The first unauthorized input is at 1/8 of the inputs, the rest is skipped
+void BM_ParallelFatal(benchmark::State& state) {
+  const auto inputs = MakeInputs();
+  const ParallelPolicy<Unauthorized> policy{.threads = static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    auto results = ParallelTransform(inputs, MakeTransform(kSize / 8), policy);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Sequential)->Name("ParallelTransform/Sequential")->UseRealTime();
+BENCHMARK(BM_Parallel)->Name("ParallelTransform/Threads")
+  ->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+BENCHMARK(BM_ParallelFatal)->Name("ParallelTransform/FatalThreads")
+  ->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+}  // namespace voe
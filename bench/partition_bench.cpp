@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/batch.h"
+
+namespace voe {
+
+namespace {
+
+struct Timeout { int ms; };
+struct Refused { std::string host; };
+
+using Result = ValueOrError<double, Timeout, Refused>;
+using Error = VoidOrError<Timeout, Refused>;
+
+// The errors are scattered pseudo-randomly, so that the branches on them are not predictable
+std::vector<Result> MakeResults(int error_percent) {
+  std::vector<Result> results;
+  uint32_t state = 12345;
+  for (size_t i = 0; i < 1 << 16; ++i) {
+    state = state * 1664525 + 1013904223;
+    if (static_cast<int>((state >> 8) % 100) >= error_percent) {
+      results.emplace_back(static_cast<double>(i));
+    } else if (state % 4 == 0) {
+      results.emplace_back(MakeError<Refused>("host"));
+    } else {
+      results.emplace_back(MakeError<Timeout>(static_cast<int>(i)));
+    }
+  }
+  return results;
+}
+
+void BM_ScalarPartition(benchmark::State& state) {
+  const auto results = MakeResults(static_cast<int>(state.range(0)));
+  std::vector<double> values;
+  std::vector<Error> errors;
+  std::vector<size_t> value_positions;
+  std::vector<size_t> error_positions;
+  for (auto _ : state) {
+    values.clear();
+    errors.clear();
+    value_positions.clear();
+    error_positions.clear();
+    for (size_t i = 0; i < results.size(); ++i) {
+      if (results[i].HasValue()) {
+        values.push_back(results[i].GetValue());
+        value_positions.push_back(i);
+      } else {
+        errors.emplace_back(results[i]);
+        error_positions.push_back(i);
+      }
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::DoNotOptimize(errors.data());
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_Partition(benchmark::State& state) {
+  const auto results = MakeResults(static_cast<int>(state.range(0)));
+  std::vector<double> values;
+  std::vector<Error> errors;
+  std::vector<size_t> value_positions;
+  std::vector<size_t> error_positions;
+  for (auto _ : state) {
+    values.clear();
+    errors.clear();
+    value_positions.clear();
+    error_positions.clear();
+    Partition(results, values, errors, value_positions, error_positions);
+    benchmark::DoNotOptimize(values.data());
+    benchmark::DoNotOptimize(errors.data());
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_ScalarCompactValues(benchmark::State& state) {
+  const auto results = MakeResults(static_cast<int>(state.range(0)));
+  std::vector<double> values;
+  for (auto _ : state) {
+    values.clear();
+    for (const auto& result : results) {
+      if (result.HasValue()) {
+        values.push_back(result.GetValue());
+      }
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_CompactValues(benchmark::State& state) {
+  const auto results = MakeResults(static_cast<int>(state.range(0)));
+  std::vector<double> values;
+  for (auto _ : state) {
+    values.clear();
+    CompactValues(results, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+}  // namespace
+
+#define VOE_PARTITION_BENCHMARK(function, name) \
+  BENCHMARK(function)->Name(name)->Arg(1)->Arg(10)->Arg(30)->Arg(50)
+
+VOE_PARTITION_BENCHMARK(BM_ScalarPartition, "Partition/Partition/Scalar");
+VOE_PARTITION_BENCHMARK(BM_Partition, "Partition/Partition/Batch");
+VOE_PARTITION_BENCHMARK(BM_ScalarCompactValues, "Partition/CompactValues/Scalar");
+VOE_PARTITION_BENCHMARK(BM_CompactValues, "Partition/CompactValues/Batch");
+
+#undef VOE_PARTITION_BENCHMARK
+
+}  // namespace voe
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "value_or_error.h"
+
+namespace voe {
+
+namespace {
+
+template <int Kind>
+struct StepError { int code; };
+
+// The step Index sees the input incremented by the previous steps, i.e. input + Index, so
+// it fails on the input Index
+template <int Index>
+[[gnu::noinline]] ValueOrError<int, StepError<Index % 3>> Step(int x) {
+  if (x == 2 * Index) {
+    return MakeError<StepError<Index % 3>>(x);
+  }
+  return x + 1;
+}
+
+using Result = ValueOrError<int, StepError<0>, StepError<1>, StepError<2>>;
+
+Result HandWritten(int x) {
+  ASSIGN_OR_RETURN_ERROR(x, Step<0>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<1>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<2>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<3>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<4>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<5>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<6>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<7>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<8>(x));
+  ASSIGN_OR_RETURN_ERROR(x, Step<9>(x));
+  return x;
+}
+
+Result Chained(int x) {
+  return Step<0>(x)
+    .AndThen(Step<1>).AndThen(Step<2>).AndThen(Step<3>).AndThen(Step<4>)
+    .AndThen(Step<5>).AndThen(Step<6>).AndThen(Step<7>).AndThen(Step<8>)
+    .AndThen(Step<9>);
+}
+
+constexpr auto kPipeline = Pipe(
+    Step<0>, Step<1>, Step<2>, Step<3>, Step<4>,
+    Step<5>, Step<6>, Step<7>, Step<8>, Step<9>);
+
+Result Piped(int x) {
+  return kPipeline(x);
+}
+
+template <Result (*Function)(int)>
+void BM_TenSteps(benchmark::State& state) {
+  // Inputs 0..9 fail on the respective step, the rest pass all the steps
+  std::vector<int> inputs(1024);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = i % 100 < static_cast<size_t>(state.range(0)) ? i % 10 : -100;
+  }
+
+  for (auto _ : state) {
+    for (int input : inputs) {
+      auto result = Function(input);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_TenSteps<HandWritten>)->Name("TenSteps/HandWritten")->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(BM_TenSteps<Chained>)->Name("TenSteps/AndThen")->Arg(0)->Arg(10)->Arg(50);
+BENCHMARK(BM_TenSteps<Piped>)->Name("TenSteps/Pipe")->Arg(0)->Arg(10)->Arg(50);
+
+}  // namespace voe
@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/batch.h"
+#include "voe/status_array.h"
+
+namespace voe {
+
+namespace {
+
+struct Missing {};
+struct TooLong {};
+struct BadChar {};
+struct Duplicate {};
+struct Reserved {};
+
+using RowStatus = VoidOrError<Missing, TooLong, BadChar, Duplicate, Reserved>;
+
+constexpr size_t kRows = 1 << 24;
+
+// One row in 50 fails, BadChar being the rarest error
+RowStatus MakeRowStatus(size_t row) {
+  switch (row * 2654435761u % 250) {
+    case 0: case 1: return MakeError<Missing>();
+    case 2: case 3: return MakeError<TooLong>();
+    case 4: return MakeError<BadChar>();
+    default: return row % 50 == 7 ? RowStatus{MakeError<Duplicate>()} : RowStatus{};
+  }
+}
+
+std::vector<RowStatus> MakeArray() {
+  std::vector<RowStatus> statuses;
+  statuses.reserve(kRows);
+  for (size_t row = 0; row < kRows; ++row) {
+    statuses.push_back(MakeRowStatus(row));
+  }
+  return statuses;
+}
+
+StatusArray<RowStatus> MakeStatusArray() {
+  StatusArray<RowStatus> statuses;
+  statuses.reserve(kRows);
+  for (size_t row = 0; row < kRows; ++row) {
+    statuses.push_back(MakeRowStatus(row));
+  }
+  return statuses;
+}
+
+void BM_CountArray(benchmark::State& state) {
+  const auto statuses = MakeArray();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ErrorHistogram(statuses)[2]);
+  }
+  state.SetItemsProcessed(state.iterations() * statuses.size());
+  state.counters["bytes_per_row"] = sizeof(RowStatus);
+}
+
+void BM_CountStatusArray(benchmark::State& state) {
+  const auto statuses = MakeStatusArray();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(statuses.CountErrors<BadChar>());
+  }
+  state.SetItemsProcessed(state.iterations() * statuses.size());
+  // 3 bit planes for the 5 error types
+  state.counters["bytes_per_row"] = 3.0 / 8;
+}
+
+void BM_FindArray(benchmark::State& state) {
+  auto statuses = MakeArray();
+  std::erase_if(statuses, [](const RowStatus& status) { return status.HasError<Reserved>(); });
+  statuses.back() = MakeError<Reserved>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::ranges::find_if(
+        statuses, [](const RowStatus& status) { return status.HasError<Reserved>(); }));
+  }
+  state.SetItemsProcessed(state.iterations() * statuses.size());
+}
+
+void BM_FindStatusArray(benchmark::State& state) {
+  auto statuses = MakeStatusArray();
+  statuses[statuses.size() - 1] = MakeError<Reserved>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(statuses.FindError<Reserved>());
+  }
+  state.SetItemsProcessed(state.iterations() * statuses.size());
+}
+
+void BM_MergeArray(benchmark::State& state) {
+  auto lhs = MakeArray();
+  const auto rhs = MakeArray();
+  for (auto _ : state) {
+    for (size_t row = 0; row < lhs.size(); ++row) {
+      if (!lhs[row].HasAnyError()) {
+        lhs[row] = rhs[row];
+      }
+    }
+    benchmark::DoNotOptimize(lhs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+void BM_MergeStatusArray(benchmark::State& state) {
+  auto lhs = MakeStatusArray();
+  const auto rhs = MakeStatusArray();
+  for (auto _ : state) {
+    lhs.Merge(rhs);
+    benchmark::DoNotOptimize(lhs);
+  }
+  state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_CountArray)->Name("StatusArray/CountErrors/Array");
+BENCHMARK(BM_CountStatusArray)->Name("StatusArray/CountErrors/StatusArray");
+BENCHMARK(BM_FindArray)->Name("StatusArray/FindError/Array");
+BENCHMARK(BM_FindStatusArray)->Name("StatusArray/FindError/StatusArray");
+BENCHMARK(BM_MergeArray)->Name("StatusArray/Merge/Array");
+BENCHMARK(BM_MergeStatusArray)->Name("StatusArray/Merge/StatusArray");
+
+}  // namespace voe
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/vector.h"
+
+namespace voe {
+
+namespace {
+
+struct Code { int value; };
+
+// A large and rare error, that sizes every element of the array of ValueOrError objects
+struct Diagnostic {
+  std::string file;
+  std::string message;
+  int line;
+};
+
+using Result = ValueOrError<long, Code, Diagnostic>;
+
+constexpr size_t kSize = 1 << 20;
+
+bool IsFailure(size_t i) { return i % 100 == 0; }
+
+std::vector<Result> MakeArray() {
+  std::vector<Result> results;
+  results.reserve(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    if (IsFailure(i)) {
+      results.push_back(MakeError<Diagnostic>("a.cpp", "failure", static_cast<int>(i)));
+    } else {
+      results.push_back(static_cast<long>(i));
+    }
+  }
+  return results;
+}
+
+ValueOrErrorVector<long, Code, Diagnostic> MakeVector() {
+  ValueOrErrorVector<long, Code, Diagnostic> results;
+  results.reserve(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    if (IsFailure(i)) {
+      results.EmplaceBackError<Diagnostic>("a.cpp", "failure", static_cast<int>(i));
+    } else {
+      results.emplace_back(static_cast<long>(i));
+    }
+  }
+  return results;
+}
+
+void BM_ScanArray(benchmark::State& state) {
+  const auto results = MakeArray();
+  for (auto _ : state) {
+    size_t errors = 0;
+    for (const auto& result : results) {
+      errors += result.HasAnyError();
+    }
+    benchmark::DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+  state.counters["bytes_per_element"] = sizeof(Result);
+}
+
+void BM_ScanVector(benchmark::State& state) {
+  const auto results = MakeVector();
+  for (auto _ : state) {
+    size_t errors = 0;
+    for (auto index : results.Indices()) {
+      errors += index >= Result::LogicalFirstErrorIndex();
+    }
+    benchmark::DoNotOptimize(errors);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+  state.counters["bytes_per_element"] = double(
+      results.Indices().size_bytes() + results.size() * sizeof(uint32_t) +
+      results.Values().size_bytes() + results.Errors<Diagnostic>().size_bytes()) / results.size();
+}
+
+void BM_SumArray(benchmark::State& state) {
+  const auto results = MakeArray();
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto& result : results) {
+      if (result.HasValue()) {
+        sum += result.GetValue();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_SumVector(benchmark::State& state) {
+  const auto results = MakeVector();
+  for (auto _ : state) {
+    long sum = 0;
+    for (long value : results.Values()) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScanArray)->Name("Vector/ScanErrors/Array");
+BENCHMARK(BM_ScanVector)->Name("Vector/ScanErrors/ValueOrErrorVector");
+BENCHMARK(BM_SumArray)->Name("Vector/SumValues/Array");
+BENCHMARK(BM_SumVector)->Name("Vector/SumValues/ValueOrErrorVector");
+
+}  // namespace voe
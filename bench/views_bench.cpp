@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/views.h"
+
+namespace voe {
+
+namespace {
+
+struct Timeout { int ms; };
+struct Refused { std::string host; };
+
+using Result = ValueOrError<long, Timeout, Refused>;
+
+constexpr size_t kSize = 1 << 16;
+
+std::vector<Result> MakeResults(size_t error_period) {
+  std::vector<Result> results;
+  results.reserve(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    if (i % error_period == error_period - 1) {
+      results.emplace_back(MakeError<Timeout>(static_cast<int>(i)));
+    } else {
+      results.emplace_back(static_cast<long>(i));
+    }
+  }
+  return results;
+}
+
+// The filter loop the views replace: the values are copied to a temporary vector first
+void BM_SumLoop(benchmark::State& state) {
+  const auto results = MakeResults(100);
+  for (auto _ : state) {
+    std::vector<long> values;
+    for (const auto& result : results) {
+      if (result.HasValue()) {
+        values.push_back(result.GetValue());
+      }
+    }
+    long sum = 0;
+    for (long value : values) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_SumView(benchmark::State& state) {
+  const auto results = MakeResults(100);
+  for (auto _ : state) {
+    long sum = 0;
+    for (long value : results | views::values) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+// The results hold no errors, so the whole range is collected
+void BM_CollectLoop(benchmark::State& state) {
+  const auto results = MakeResults(kSize + 1);
+  for (auto _ : state) {
+    ValueOrError<std::vector<long>, Timeout, Refused> collected;
+    std::vector<long> values;
+    for (const auto& result : results) {
+      if (!result.HasValue()) {
+        collected = result.DiscardValue();
+        break;
+      }
+      values.push_back(result.GetValue());
+    }
+    if (!collected.HasAnyError()) {
+      collected = std::move(values);
+    }
+    benchmark::DoNotOptimize(collected);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_Collect(benchmark::State& state) {
+  const auto results = MakeResults(kSize + 1);
+  for (auto _ : state) {
+    auto collected = Collect(results);
+    benchmark::DoNotOptimize(collected);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SumLoop)->Name("Views/SumValues/Loop");
+BENCHMARK(BM_SumView)->Name("Views/SumValues/View");
+BENCHMARK(BM_CollectLoop)->Name("Views/Collect/Loop");
+BENCHMARK(BM_Collect)->Name("Views/Collect/Collect");
+
+}  // namespace voe
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/batch.h"
+
+namespace voe {
+
+namespace {
+
+struct NotFound { long key; };
+struct Timeout { int ms; };
+struct Refused { std::string host; };
+
+using Result = ValueOrError<long, NotFound, Timeout, Refused>;
+
+// The errors are scattered pseudo-randomly, so that visiting them is not predictable
+std::vector<Result> MakeResults(int error_percent) {
+  std::vector<Result> results;
+  uint32_t state = 12345;
+  for (size_t i = 0; i < 1 << 16; ++i) {
+    state = state * 1664525 + 1013904223;
+    if (static_cast<int>((state >> 8) % 100) >= error_percent) {
+      results.emplace_back(static_cast<long>(i));
+    } else if (state % 3 == 0) {
+      results.emplace_back(MakeError<NotFound>(static_cast<long>(i)));
+    } else if (state % 3 == 1) {
+      results.emplace_back(MakeError<Timeout>(static_cast<int>(i)));
+    } else {
+      results.emplace_back(MakeError<Refused>("host"));
+    }
+  }
+  return results;
+}
+
+struct Totals {
+  long values = 0;
+  long not_found = 0;
+  long timeouts = 0;
+  size_t refused = 0;
+
+  void operator()(long value) { values += value; }
+  void operator()(const NotFound& error) { not_found += error.key; }
+  void operator()(const Timeout& error) { timeouts += error.ms; }
+  void operator()(const Refused& error) { refused += error.host.size(); }
+};
+
+void BM_VisitEach(benchmark::State& state) {
+  const auto results = MakeResults(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    Totals totals;
+    for (const auto& result : results) {
+      result.Visit([&totals](const auto& alternative) { totals(alternative); });
+    }
+    benchmark::DoNotOptimize(totals);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_VisitAll(benchmark::State& state) {
+  const auto results = MakeResults(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    Totals totals;
+    VisitAll(results, [&totals](const auto& alternative) { totals(alternative); });
+    benchmark::DoNotOptimize(totals);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+void BM_VisitAllVector(benchmark::State& state) {
+  ValueOrErrorVector<long, NotFound, Timeout, Refused> results;
+  for (auto& result : MakeResults(static_cast<int>(state.range(0)))) {
+    results.push_back(std::move(result));
+  }
+  for (auto _ : state) {
+    Totals totals;
+    VisitAll(results, [&totals](const auto& alternative) { totals(alternative); });
+    benchmark::DoNotOptimize(totals);
+  }
+  state.SetItemsProcessed(state.iterations() * results.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_VisitEach)->Name("VisitAll/Each")->Arg(1)->Arg(10)->Arg(50);
+BENCHMARK(BM_VisitAll)->Name("VisitAll/Grouped")->Arg(1)->Arg(10)->Arg(50);
+BENCHMARK(BM_VisitAllVector)->Name("VisitAll/ValueOrErrorVector")->Arg(1)->Arg(10)->Arg(50);
+
+}  // namespace voe
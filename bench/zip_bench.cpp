@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "value_or_error.h"
+#include "voe/zip.h"
+
+namespace voe {
+
+namespace {
+
+struct NotFound { long key; };
+struct Timeout { int ms; };
+struct Refused { std::string host; };
+
+using User = ValueOrError<std::string, NotFound>;
+using Cart = ValueOrError<std::vector<int>, Timeout>;
+using Score = ValueOrError<long, NotFound, Refused>;
+
+using Joined = ValueOrError<std::tuple<std::string, std::vector<int>, long>,
+                            NotFound, Timeout, Refused>;
+
+struct Shard {
+  User user;
+  Cart cart;
+  Score score;
+};
+
+// Every error_period-th shard fails on one of the three results
+std::vector<Shard> MakeShards(size_t error_period) {
+  std::vector<Shard> shards;
+  for (size_t i = 0; i < 1024; ++i) {
+    Shard shard{
+      std::string("user name long enough to allocate"), std::vector<int>(4, 1),
+      static_cast<long>(i)};
+    if (i % error_period == error_period - 1) {
+      shard.cart = MakeError<Timeout>(static_cast<int>(i));
+    }
+    shards.push_back(std::move(shard));
+  }
+  return shards;
+}
+
+// The nested checks the Zip replaces: the values are moved to locals, and then to the tuple
+Joined JoinNested(User&& user, Cart&& cart, Score&& score) {
+  if (!user.HasValue()) {
+    return Joined(detail_::UncheckedConvertTag{}, std::move(user));
+  }
+  std::string name = std::move(user).GetValue();
+  if (!cart.HasValue()) {
+    return Joined(detail_::UncheckedConvertTag{}, std::move(cart));
+  }
+  std::vector<int> items = std::move(cart).GetValue();
+  if (!score.HasValue()) {
+    return Joined(detail_::UncheckedConvertTag{}, std::move(score));
+  }
+  return Joined(std::make_tuple(std::move(name), std::move(items), score.GetValue()));
+}
+
+template <typename Join>
+void RunJoin(benchmark::State& state, Join join) {
+  const auto shards = MakeShards(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copies = shards;
+    state.ResumeTiming();
+    for (Shard& shard : copies) {
+      auto joined = join(std::move(shard.user), std::move(shard.cart), std::move(shard.score));
+      benchmark::DoNotOptimize(joined);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * shards.size());
+}
+
+void BM_Nested(benchmark::State& state) { RunJoin(state, JoinNested); }
+
+void BM_Zip(benchmark::State& state) {
+  RunJoin(state, [](User&& user, Cart&& cart, Score&& score) {
+    return Zip(std::move(user), std::move(cart), std::move(score));
+  });
+}
+
+}  // namespace
+
+BENCHMARK(BM_Nested)->Name("Zip/Nested")->Arg(1000000)->Arg(10);
+BENCHMARK(BM_Zip)->Name("Zip/Zip")->Arg(1000000)->Arg(10);
+
+}  // namespace voe
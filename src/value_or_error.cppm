@@ -0,0 +1,75 @@
+// The voe named module.
+//
+// Macros can not be exported from a module, so the code using RETURN_IF_ERROR or
+// ASSIGN_OR_RETURN_ERROR has to include "voe/macros.h" next to `import voe;`.
+
+module;
+
+#include "value_or_error.h"
+#include "voe/batch.h"
+#include "voe/error_list.h"
+#include "voe/parallel.h"
+#include "voe/status_array.h"
+#include "voe/vector.h"
+#include "voe/views.h"
+#include "voe/zip.h"
+
+export module voe;
+
+export namespace voe {
+
+using voe::ErrorCategoryTraits;
+using voe::NeverEmptyTraits;
+
+using voe::ValueOrError;
+using voe::VoidOrError;
+using voe::MakeError;
+
+using voe::Union;
+using voe::Flat;
+using voe::Canonical;
+using voe::CanonicalUnion;
+using voe::Categorized;
+
+using voe::ValueOrErrorRef;
+using voe::VoidOrErrorRef;
+
+using voe::ValueOrErrorVector;
+using voe::VoidOrErrorVector;
+
+using voe::StatusArray;
+
+using voe::ErrorList;
+using voe::CollectErrors;
+using voe::CheckAll;
+
+using voe::FindFirstError;
+using voe::AllOk;
+using voe::CountErrors;
+using voe::ErrorHistogram;
+using voe::SuccessMask;
+using voe::VisitAll;
+using voe::VisitAllIndexed;
+using voe::ConvertAll;
+using voe::CompactValues;
+using voe::Partition;
+
+using voe::Pipeline;
+using voe::Pipe;
+
+using voe::Zip;
+
+using voe::ParallelPolicy;
+using voe::ParallelTransform;
+
+using voe::Collect;
+
+}  // namespace voe
+
+export namespace voe::views {
+
+using voe::views::values;
+using voe::views::errors;
+using voe::views::ok_or_stop;
+
+}  // namespace voe::views
@@ -0,0 +1,717 @@
+#ifndef VOE_BATCH_HEADER
+#define VOE_BATCH_HEADER
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "voe/core.h"
+#include "voe/kernels.h"
+#include "voe/vector.h"
+
+namespace voe {
+
+namespace detail_ {
+
+// The number of logical indices gathered from the ValueOrError objects at once, a multiple of 64
+inline constexpr size_t kGatherBlockSize = 256;
+
+template <typename Results>
+struct BatchSource;
+
+/**
+ * @brief Gathers the logical indices of the contiguous ValueOrError objects into blocks
+ */
+template <typename Results>
+  requires std::ranges::contiguous_range<Results>
+        && IsValueOrError<std::ranges::range_value_t<Results>>
+struct BatchSource<Results> {
+  using Result = std::ranges::range_value_t<Results>;
+  using Index = std::remove_cvref_t<decltype(std::declval<const Result&>().LogicalIndex())>;
+
+  /**
+   * @brief Calls callable(indices, size, offset) for the consecutive blocks of the indices
+   *
+   * Stops once the callable returns true. The offsets are multiples of 64.
+   */
+  template <typename Callable>
+  static void ForEachBlock(const Results& results, Callable&& callable) {
+    const auto* data = std::ranges::data(results);
+    const size_t size = std::ranges::size(results);
+    Index block[kGatherBlockSize];
+    for (size_t offset = 0; offset < size; offset += kGatherBlockSize) {
+      const size_t count = std::min(kGatherBlockSize, size - offset);
+      for (size_t i = 0; i < count; ++i) {
+        block[i] = data[offset + i].LogicalIndex();
+      }
+      if (callable(static_cast<const Index*>(block), count, offset)) {
+        return;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Passes the dense indices array of the ValueOrErrorVector as a single block
+ */
+template <typename ValueType, typename... ErrorTypes>
+struct BatchSource<ValueOrErrorVector<ValueType, ErrorTypes...>> {
+  using Result = ValueOrError<ValueType, ErrorTypes...>;
+  using Index = typename ValueOrErrorVector<ValueType, ErrorTypes...>::IndexType;
+
+  template <typename Callable>
+  static void ForEachBlock(
+      const ValueOrErrorVector<ValueType, ErrorTypes...>& results, Callable&& callable)
+  {
+    if (!results.empty()) {
+      callable(results.Indices().data(), results.size(), size_t{0});
+    }
+  }
+};
+
+template <typename Results>
+concept BatchQueryable = requires { typename BatchSource<std::remove_cvref_t<Results>>::Result; };
+
+template <typename Result>
+constexpr size_t LogicalSuccessIndex() noexcept {
+  if constexpr (std::is_void_v<typename Result::value_type>) {
+    return Result::LogicalEmptyIndex();
+  } else {
+    return Result::LogicalValueIndex();
+  }
+}
+
+template <typename Result>
+struct ErrorCountHolder;
+
+template <typename ValueType, typename... ErrorTypes>
+struct ErrorCountHolder<ValueOrError<ValueType, ErrorTypes...>> {
+  static constexpr size_t value = sizeof...(ErrorTypes);
+};
+
+}  // namespace detail_
+
+// The batch queries accept either a contiguous range of ValueOrError objects (such as std::vector
+// or std::span), or a ValueOrErrorVector. They evaluate the one byte logical indices with SSE2 or
+// AVX2 kernels selected at runtime, see VOE_BATCH_SIMD. The indices of the ValueOrError objects
+// are gathered into small blocks first, while the ValueOrErrorVector indices are evaluated in
+// place, which is considerably faster.
+
+/**
+ * @return the position of the first result holding an error, or the number of results if none
+ */
+template <typename Results>
+  requires detail_::BatchQueryable<Results>
+size_t FindFirstError(const Results& results) {
+  using Source = detail_::BatchSource<std::remove_cvref_t<Results>>;
+  using Kernels = detail_::IndexKernels<typename Source::Index>;
+  constexpr size_t first_error_index = Source::Result::LogicalFirstErrorIndex();
+
+  size_t found = std::ranges::size(results);
+  Source::ForEachBlock(results, [&](const auto* indices, size_t size, size_t offset) {
+    const size_t position = Kernels::FindAtLeast(indices, size, first_error_index);
+    if (position == size) {
+      return false;
+    }
+    found = offset + position;
+    return true;
+  });
+  return found;
+}
+
+/**
+ * @return whether none of the results holds an error
+ * @note the empty results are not errors
+ */
+template <typename Results>
+  requires detail_::BatchQueryable<Results>
+bool AllOk(const Results& results) {
+  return FindFirstError(results) == std::ranges::size(results);
+}
+
+/**
+ * @return the number of results holding an error
+ */
+template <typename Results>
+  requires detail_::BatchQueryable<Results>
+size_t CountErrors(const Results& results) {
+  using Source = detail_::BatchSource<std::remove_cvref_t<Results>>;
+  using Kernels = detail_::IndexKernels<typename Source::Index>;
+  constexpr size_t first_error_index = Source::Result::LogicalFirstErrorIndex();
+
+  size_t count = 0;
+  Source::ForEachBlock(results, [&](const auto* indices, size_t size, size_t) {
+    count += Kernels::CountAtLeast(indices, size, first_error_index);
+    return false;
+  });
+  return count;
+}
+
+/**
+ * @return the number of results holding each of the error types, in the ErrorTypes... order
+ */
+template <typename Results>
+  requires detail_::BatchQueryable<Results>
+auto ErrorHistogram(const Results& results) {
+  using Source = detail_::BatchSource<std::remove_cvref_t<Results>>;
+  using Kernels = detail_::IndexKernels<typename Source::Index>;
+  constexpr size_t first_error_index = Source::Result::LogicalFirstErrorIndex();
+  constexpr size_t error_count = detail_::ErrorCountHolder<typename Source::Result>::value;
+
+  std::array<size_t, error_count> histogram{};
+  Source::ForEachBlock(results, [&](const auto* indices, size_t size, size_t) {
+    // The errors are rare, so the blocks without errors are only scanned once
+    if (Kernels::CountAtLeast(indices, size, first_error_index) != 0) {
+      for (size_t error = 0; error < error_count; ++error) {
+        histogram[error] += Kernels::CountEqual(indices, size, first_error_index + error);
+      }
+    }
+    return false;
+  });
+  return histogram;
+}
+
+/**
+ * @brief Sets the bit i % 64 of mask[i / 64] iff the i-th result is a success
+ *
+ * The success is holding a value, or being empty for ValueOrError<void, ...>.
+ * All the (size + 63) / 64 words of the mask are written.
+ *
+ * @exception UB if mask.size() < (size + 63) / 64
+ */
+template <typename Results>
+  requires detail_::BatchQueryable<Results>
+void SuccessMask(const Results& results, std::span<uint64_t> mask) {
+  using Source = detail_::BatchSource<std::remove_cvref_t<Results>>;
+  using Kernels = detail_::IndexKernels<typename Source::Index>;
+  constexpr size_t success_index = detail_::LogicalSuccessIndex<typename Source::Result>();
+
+  VOE_CONTRACT_CHECK(
+      mask.size() * 64 >= std::ranges::size(results), "SuccessMask() mask is too small");
+  Source::ForEachBlock(results, [&](const auto* indices, size_t size, size_t offset) {
+    Kernels::MaskEqual(indices, size, success_index, mask.data() + offset / 64);
+    return false;
+  });
+}
+
+
+namespace detail_ {
+
+// The number of elements split at once into the hot and the other ones, see ForEachIndexGroup
+inline constexpr size_t kGroupBlockSize = 512;
+
+/**
+ * @brief Groups the positions of the elements by their logical indices
+ *
+ * Calls callable(std::integral_constant<size_t, LogicalIndex>{}, positions) with the ascending
+ * ranges of the positions of the elements holding each of the alternatives, in the ascending
+ * order of the logical indices. The hot alternative (the value, or the success for void results)
+ * is passed in several calls, block by block: each block is split without branches into the hot
+ * positions and the other ones, and the hot ones are passed while the block is still cached.
+ * The other positions are collected, sorted with a counting pass and a placement pass, and
+ * passed once all the blocks are done. A block holding only the hot alternative is passed as
+ * a range of consecutive positions.
+ *
+ * For the ValueOrError<void, ...> results the success is the lowest logical index, and the
+ * non-void results must not be empty, so all the calls are in the ascending order of the
+ * logical indices.
+ */
+template <typename Result, typename IndexAt, typename Callable>
+void ForEachIndexGroup(size_t size, const IndexAt& index_at, Callable&& callable) {
+  constexpr size_t hot_index = LogicalSuccessIndex<Result>();
+  constexpr size_t group_count = LogicalIndexCount<Result>;
+
+  VOE_CONTRACT_CHECK(
+      size <= std::numeric_limits<uint32_t>::max(), "Too many elements to group by index");
+  std::vector<uint32_t> others;
+  uint32_t hot_block[kGroupBlockSize];
+  uint32_t other_block[kGroupBlockSize];
+  for (size_t offset = 0; offset < size; offset += kGroupBlockSize) {
+    const size_t count = std::min(kGroupBlockSize, size - offset);
+    size_t hot_count = 0;
+    size_t other_count = 0;
+    for (size_t position = offset; position < offset + count; ++position) {
+      const bool is_hot = index_at(position) == hot_index;
+      hot_block[hot_count] = static_cast<uint32_t>(position);
+      other_block[other_count] = static_cast<uint32_t>(position);
+      hot_count += is_hot;
+      other_count += !is_hot;
+    }
+    if (other_count == 0) {
+      callable(
+          std::integral_constant<size_t, hot_index>{},
+          std::views::iota(offset, offset + count));
+      continue;
+    }
+    if (hot_count != 0) {
+      callable(
+          std::integral_constant<size_t, hot_index>{},
+          std::span<const uint32_t>(hot_block, hot_count));
+    }
+    others.insert(others.end(), other_block, other_block + other_count);
+  }
+  if (others.empty()) {
+    return;
+  }
+
+  std::array<size_t, group_count> group_sizes{};
+  for (uint32_t position : others) {
+    ++group_sizes[index_at(position)];
+  }
+  std::array<size_t, group_count> group_offsets{};
+  for (size_t group = 1; group < group_count; ++group) {
+    group_offsets[group] = group_offsets[group - 1] + group_sizes[group - 1];
+  }
+  std::vector<uint32_t> sorted(others.size());
+  std::array<size_t, group_count> next = group_offsets;
+  for (uint32_t position : others) {
+    sorted[next[index_at(position)]++] = position;
+  }
+  [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+    (..., (Indices != hot_index && group_sizes[Indices] != 0
+        ? callable(
+            std::integral_constant<size_t, Indices>{},
+            std::span<const uint32_t>(sorted.data() + group_offsets[Indices], group_sizes[Indices]))
+        : void()));
+  }(std::make_index_sequence<group_count>{});
+}
+
+/**
+ * @return the array of the ValueOrErrorVector holding the alternative with the physical index
+ */
+template <size_t PhysicalIndex, typename Vector>
+auto StoredArray(Vector& vector) noexcept {
+  using Result = typename BatchSource<std::remove_const_t<Vector>>::Result;
+  if constexpr (PhysicalIndex == 0 && !std::is_void_v<typename Result::value_type>) {
+    return vector.Values();
+  } else {
+    return vector.template Errors<typename Result::template StoredType<PhysicalIndex>>();
+  }
+}
+
+template <typename Results>
+struct IsValueOrErrorVectorHolder : public std::false_type {};
+
+template <typename ValueType, typename... ErrorTypes>
+struct IsValueOrErrorVectorHolder<ValueOrErrorVector<ValueType, ErrorTypes...>>
+  : public std::true_type {};
+
+template <typename Results>
+inline constexpr bool IsValueOrErrorVector =
+  IsValueOrErrorVectorHolder<std::remove_cvref_t<Results>>::value;
+
+/**
+ * @brief Calls visitor(position, alternative) or visitor(position) for every element, grouped
+ * by the held alternatives
+ */
+template <typename Results, typename Visitor>
+void VisitGroups(Results& results, Visitor& visitor) {
+  using Result = typename BatchSource<std::remove_const_t<Results>>::Result;
+
+  std::array<size_t, Result::StoredCount> slots{};
+  auto visit_group = [&](auto logical_index, const auto& positions) {
+    if constexpr (IsLogicalEmptyIndex<Result>(logical_index)) {
+      if constexpr (std::is_void_v<typename Result::value_type>) {
+        for (size_t position : positions) {
+          visitor(position);
+        }
+      } else {
+        VOE_CONTRACT_CHECK(positions.empty(), "VisitAll() called on a range with empty objects");
+      }
+    } else {
+      constexpr size_t physical_index = Result::LogicalToPhysicalIndex(logical_index);
+      if constexpr (IsValueOrErrorVector<Results>) {
+        // The elements holding the alternative are stored in its array in the same order
+        const auto array = StoredArray<physical_index>(results);
+        size_t& slot = slots[physical_index];
+        for (size_t position : positions) {
+          visitor(position, array[slot++]);
+        }
+      } else {
+        auto* data = std::ranges::data(results);
+        for (size_t position : positions) {
+          visitor(position, Get<physical_index>(data[position].Data()));
+        }
+      }
+    }
+  };
+
+  if constexpr (IsValueOrErrorVector<Results>) {
+    const auto indices = results.Indices();
+    ForEachIndexGroup<Result>(
+        indices.size(), [&indices](size_t position) { return indices[position]; }, visit_group);
+  } else {
+    const auto* data = std::ranges::data(results);
+    ForEachIndexGroup<Result>(
+        std::ranges::size(results),
+        [data](size_t position) { return data[position].LogicalIndex(); },
+        visit_group);
+  }
+}
+
+}  // namespace detail_
+
+/**
+ * @brief Visits all the results, grouped by the held alternative
+ *
+ * Calls the visitor the same way as ValueOrError::Visit does for each of the results, first for
+ * all the results holding the alternative with the lowest logical index, then the next one, and
+ * so on: e.g. for all the values, then for all the errors of the first type. Within the groups
+ * the results are visited in their order. The grouping avoids the mispredicted branches and
+ * indirect calls of visiting a mixed range element by element.
+ *
+ * Accepts a contiguous range of ValueOrError objects, the held values and errors are passed as
+ * lvalues with the range constness, or a ValueOrErrorVector, whose arrays are visited directly.
+ *
+ * @exception UB if ValueType is not void and some of the results are empty
+ * @see VisitAllIndexed to get the positions of the visited results
+ */
+template <typename Results, typename Visitor>
+  requires detail_::BatchQueryable<Results>
+void VisitAll(Results&& results, Visitor&& visitor) {
+  using Result = typename detail_::BatchSource<std::remove_cvref_t<Results>>::Result;
+
+  if constexpr (detail_::IsValueOrErrorVector<Results>) {
+    if constexpr (!std::is_void_v<typename Result::value_type>) {
+      VOE_CONTRACT_CHECK(
+          results.Values().size() + CountErrors(results) == results.size(),
+          "VisitAll() called on a range with empty objects");
+    } else {
+      size_t error_count = 0;
+      [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+        (..., (error_count += detail_::StoredArray<Indices>(results).size()));
+      }(std::make_index_sequence<Result::StoredCount>{});
+      for (size_t i = error_count; i < results.size(); ++i) {
+        visitor();
+      }
+    }
+    [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+      (..., [&] {
+        for (auto& alternative : detail_::StoredArray<Indices>(results)) {
+          visitor(alternative);
+        }
+      }());
+    }(std::make_index_sequence<Result::StoredCount>{});
+  } else {
+    auto visit = [&visitor](size_t, auto&... alternative) { visitor(alternative...); };
+    detail_::VisitGroups(results, visit);
+  }
+}
+
+/**
+ * @brief Visits all the results, grouped by the held alternative, passing their positions
+ *
+ * The same as VisitAll, but the visitor is called as visitor(position, alternative) or
+ * visitor(position) for the empty ValueOrError<void, ...> results, so that the outcomes can be
+ * stored in the order of the results.
+ *
+ * @exception UB if ValueType is not void and some of the results are empty
+ */
+template <typename Results, typename Visitor>
+  requires detail_::BatchQueryable<Results>
+void VisitAllIndexed(Results&& results, Visitor&& visitor) {
+  detail_::VisitGroups(results, visitor);
+}
+
+/**
+ * @brief Converts all the results of src into the results of dst
+ *
+ * Each of the results of dst is replaced the same way as the ValueOrError conversion assignment
+ * replaces it. The stored objects of src are moved if src is an rvalue range owning them (e.g.
+ * std::vector), and copied otherwise.
+ *
+ * If the stored objects of src are trivially copyable, and the ones of dst trivially destructible,
+ * the results are copied byte-wise, and only the logical indices are remapped with a lookup
+ * table, without dispatching on the held alternatives. Otherwise the results are converted one
+ * by one with the conversion assignment.
+ *
+ * @exception (UB) dst and src are of different sizes
+ * @exception (UB) src holds a value, and the ValueType of dst is void
+ * @exception (UB) src holds an empty result, and the results of dst are never empty
+ * @exception Any exception thrown from the conversion assignment, dst is left partially converted
+ *   then
+ */
+template <typename SrcResults, typename DstResults>
+  requires std::ranges::contiguous_range<SrcResults>
+        && std::ranges::contiguous_range<DstResults>
+        && detail_::IsValueOrError<std::ranges::range_value_t<SrcResults>>
+        && detail_::IsValueOrError<std::ranges::range_value_t<DstResults>>
+        && (!std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<DstResults>>>)
+void ConvertAll(SrcResults&& src, DstResults&& dst) {
+  using Src = std::ranges::range_value_t<SrcResults>;
+  using Dst = std::ranges::range_value_t<DstResults>;
+  constexpr bool move =
+    std::is_rvalue_reference_v<SrcResults&&> && !std::ranges::borrowed_range<SrcResults>;
+  using SrcElement = std::conditional_t<move, Src&&, const Src&>;
+  static_assert(
+      std::is_assignable_v<Dst&, SrcElement>,
+      "ConvertAll() requires the results of src to be convertible to the results of dst");
+
+  const size_t size = std::ranges::size(src);
+  VOE_CONTRACT_CHECK(
+      std::ranges::size(dst) == size, "ConvertAll() called with ranges of different sizes");
+  auto* src_data = std::ranges::data(src);
+  auto* dst_data = std::ranges::data(dst);
+
+  using SrcTree = std::remove_cvref_t<decltype(src_data->Data())>;
+  using DstTree = std::remove_cvref_t<decltype(dst_data->Data())>;
+  if constexpr (
+      std::is_trivially_copyable_v<SrcTree> && std::is_trivially_destructible_v<DstTree>
+      && sizeof(SrcTree) <= sizeof(DstTree))
+  {
+    using DstIndex = std::remove_cvref_t<decltype(dst_data->LogicalIndex())>;
+    static constexpr auto mapping = detail_::LogicalIndexMapping<Dst, Src>();
+    constexpr bool all_mapped =
+      std::ranges::find(mapping, detail_::kUnmappedIndex) == mapping.end();
+    for (size_t i = 0; i < size; ++i) {
+      const size_t index = mapping[src_data[i].LogicalIndex()];
+      if constexpr (!all_mapped) {
+        VOE_CONTRACT_CHECK(
+            index != detail_::kUnmappedIndex,
+            "ConvertAll() is trying to drop a value or to store an empty result");
+      }
+      std::memcpy(static_cast<void*>(&dst_data[i].Data()), &src_data[i].Data(), sizeof(SrcTree));
+      dst_data[i].LogicalIndex() = static_cast<DstIndex>(index);
+    }
+  } else {
+    for (size_t i = 0; i < size; ++i) {
+      dst_data[i] = detail_::ForwardLike<SrcElement>(src_data[i]);
+    }
+  }
+}
+
+namespace detail_ {
+
+// Moves the stored objects out of the rvalue ranges owning them, and copies them otherwise
+template <typename Results>
+using CompactedElement = std::conditional_t<
+    std::is_rvalue_reference_v<Results&&> && !std::ranges::borrowed_range<Results>,
+    std::ranges::range_value_t<Results>&&,
+    const std::ranges::range_value_t<Results>&>;
+
+/**
+ * @brief Calls on_value(position) for the results holding a value, and on_other(position) for
+ * the other ones
+ *
+ * The gathered indices of a block are compared with the value index at once (see SuccessMask),
+ * and the positions are extracted from the mask words bit by bit, the values first. Within each
+ * of the groups the positions are ascending, and there is no branch depending on the result.
+ */
+template <typename Results, typename OnValue, typename OnOther>
+void ForEachByValueMask(const Results& results, OnValue&& on_value, OnOther&& on_other) {
+  using Source = BatchSource<std::remove_cvref_t<Results>>;
+  using Kernels = IndexKernels<typename Source::Index>;
+
+  uint64_t mask[kGatherBlockSize / 64];
+  Source::ForEachBlock(results, [&](const auto* indices, size_t size, size_t offset) {
+    Kernels::MaskEqual(indices, size, Source::Result::LogicalValueIndex(), mask);
+    for (size_t word = 0; word * 64 < size; ++word) {
+      const size_t count = std::min<size_t>(64, size - word * 64);
+      const size_t base = offset + word * 64;
+      uint64_t values = mask[word];
+      uint64_t others = ~values & (~uint64_t{0} >> (64 - count));
+      for (; values != 0; values &= values - 1) {
+        on_value(base + std::countr_zero(values));
+      }
+      for (; others != 0; others &= others - 1) {
+        on_other(base + std::countr_zero(others));
+      }
+    }
+    return false;
+  });
+}
+
+// The number of results compacted at once into the blocks of the trivially copyable values,
+// and the largest value copied for every result, see Partition
+inline constexpr size_t kCompactBlockSize = 64;
+inline constexpr size_t kCompactMaxValueSize = 64;
+
+template <typename Results>
+concept CompactableResults = std::ranges::contiguous_range<Results>
+  && IsValueOrError<std::ranges::range_value_t<Results>>
+  && !std::is_void_v<typename std::ranges::range_value_t<Results>::value_type>;
+
+template <typename Results>
+using CompactedValue = typename std::ranges::range_value_t<Results>::value_type;
+
+/**
+ * @brief Extracts the values, and the errors unless errors is nullptr, see Partition
+ *
+ * The positions are only recorded if the respective arguments are not nullptr. The positions of
+ * the errors are collected first, and the errors are converted once the values are extracted.
+ */
+template <typename Results>
+void Partition(
+    Results&& results, auto& values, auto errors, auto value_positions, auto error_positions)
+{
+  using Element = CompactedElement<Results>;
+  using Result = std::ranges::range_value_t<Results>;
+  using Value = CompactedValue<Results>;
+  constexpr bool record_value_positions = !std::is_null_pointer_v<decltype(value_positions)>;
+  constexpr bool extract_errors = !std::is_null_pointer_v<decltype(errors)>;
+
+  auto* data = std::ranges::data(results);
+  const size_t size = std::ranges::size(results);
+  std::vector<size_t> own_error_positions;
+  std::vector<size_t>& other_positions = [&]() -> std::vector<size_t>& {
+    if constexpr (std::is_null_pointer_v<decltype(error_positions)>) {
+      return own_error_positions;
+    } else {
+      return *error_positions;
+    }
+  }();
+  const size_t others_begin = other_positions.size();
+
+  if constexpr (
+      std::is_trivially_copyable_v<Value> && std::is_default_constructible_v<Value>
+      && sizeof(Value) <= kCompactMaxValueSize)
+  {
+    // The bytes of each of the results are stored to the next slots of the block, and only the
+    // slots of its kind are advanced, so the compaction does not branch on the results. The
+    // bytes of the errors are overwritten by the next value, or dropped at the end.
+    Value value_block[kCompactBlockSize];
+    size_t value_position_block[kCompactBlockSize];
+    size_t other_position_block[kCompactBlockSize];
+    values.reserve(values.size() + size);
+    if constexpr (record_value_positions) {
+      value_positions->reserve(value_positions->size() + size);
+    }
+    for (size_t offset = 0; offset < size; offset += kCompactBlockSize) {
+      const size_t count = std::min(kCompactBlockSize, size - offset);
+      size_t value_count = 0;
+      size_t other_count = 0;
+      for (size_t position = offset; position < offset + count; ++position) {
+        const bool is_value = data[position].LogicalIndex() == Result::LogicalValueIndex();
+        std::memcpy(
+            static_cast<void*>(value_block + value_count), &data[position].Data(), sizeof(Value));
+        if constexpr (record_value_positions) {
+          value_position_block[value_count] = position;
+        }
+        if constexpr (extract_errors) {
+          other_position_block[other_count] = position;
+          other_count += !is_value;
+        }
+        value_count += is_value;
+      }
+      values.insert(values.end(), value_block, value_block + value_count);
+      if constexpr (record_value_positions) {
+        value_positions->insert(
+            value_positions->end(), value_position_block, value_position_block + value_count);
+      }
+      if constexpr (extract_errors) {
+        other_positions.insert(
+            other_positions.end(), other_position_block, other_position_block + other_count);
+      }
+    }
+  } else {
+    values.reserve(values.size() + size);
+    if constexpr (record_value_positions) {
+      value_positions->reserve(value_positions->size() + size);
+    }
+    ForEachByValueMask(
+        results,
+        [&](size_t position) {
+          values.push_back(ForwardLike<Element>(Get<0>(data[position].Data())));
+          if constexpr (record_value_positions) {
+            value_positions->push_back(position);
+          }
+        },
+        [&](size_t position) {
+          if constexpr (extract_errors) {
+            other_positions.push_back(position);
+          }
+        });
+  }
+
+  if constexpr (extract_errors) {
+    errors->reserve(errors->size() + other_positions.size() - others_begin);
+    for (size_t i = others_begin; i < other_positions.size(); ++i) {
+      auto& error = data[other_positions[i]];
+      VOE_CONTRACT_CHECK(!error.IsEmpty(), "Partition() called on a range with empty objects");
+      errors->emplace_back(ForwardLike<Element>(error));
+    }
+  }
+}
+
+}  // namespace detail_
+
+// The compaction accepts a contiguous range of ValueOrError objects. The stored objects are moved
+// out of it if it is an rvalue range owning them (e.g. std::vector), and copied otherwise. The
+// values are extracted without branching on the individual results: the small trivially copyable
+// values are copied for every result and kept for the values only, and the other ones are found
+// with a mask of the logical indices (see SuccessMask). The outputs are appended to, and their
+// storage is reserved for all the results at once.
+//
+// The values of a ValueOrErrorVector are already compacted, see ValueOrErrorVector::Values().
+
+/**
+ * @brief Appends the values held by the results to values, in the order of the results
+ */
+template <typename Results>
+  requires detail_::CompactableResults<Results>
+void CompactValues(Results&& results, std::vector<detail_::CompactedValue<Results>>& values) {
+  detail_::Partition(std::forward<Results>(results), values, nullptr, nullptr, nullptr);
+}
+
+/**
+ * @brief Appends the values held by the results to values, and their positions to positions
+ */
+template <typename Results>
+  requires detail_::CompactableResults<Results>
+void CompactValues(
+    Results&& results,
+    std::vector<detail_::CompactedValue<Results>>& values,
+    std::vector<size_t>& positions)
+{
+  detail_::Partition(std::forward<Results>(results), values, nullptr, &positions, nullptr);
+}
+
+/**
+ * @brief Appends the values held by the results to values, and the errors to errors
+ *
+ * The errors are converted to the Error type, e.g. VoidOrError<ErrorTypes...>. Both are
+ * appended in the order of the results.
+ *
+ * @exception UB if some of the results are empty
+ */
+template <typename Results, typename Error>
+  requires detail_::CompactableResults<Results>
+        && std::is_constructible_v<Error, detail_::CompactedElement<Results>>
+void Partition(
+    Results&& results,
+    std::vector<detail_::CompactedValue<Results>>& values,
+    std::vector<Error>& errors)
+{
+  detail_::Partition(std::forward<Results>(results), values, &errors, nullptr, nullptr);
+}
+
+/**
+ * @brief Appends the values and the errors as the above one, and their positions in the results
+ * to value_positions and error_positions
+ *
+ * The positions allow to match the outcomes of the next stage, running over the values, and
+ * the reported errors with the results.
+ */
+template <typename Results, typename Error>
+  requires detail_::CompactableResults<Results>
+        && std::is_constructible_v<Error, detail_::CompactedElement<Results>>
+void Partition(
+    Results&& results,
+    std::vector<detail_::CompactedValue<Results>>& values,
+    std::vector<Error>& errors,
+    std::vector<size_t>& value_positions,
+    std::vector<size_t>& error_positions)
+{
+  detail_::Partition(
+      std::forward<Results>(results), values, &errors, &value_positions, &error_positions);
+}
+
+}  // namespace voe
+
+#endif  // VOE_BATCH_HEADER
@@ -0,0 +1,201 @@
+#ifndef VOE_CANONICAL_HEADER
+#define VOE_CANONICAL_HEADER
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+
+#include "voe/core.h"
+
+namespace voe {
+
+namespace detail_ {
+
+/**
+ * @return a key that is the same for every instantiation with the same type
+ * @note the key depends only on the type's spelling, not on the order of instantiation. The
+ *       spelling differs between compilers (e.g. GCC and Clang), and distinct types may be
+ *       spelled the same (e.g. local classes of lambdas in the same function)
+ */
+template <typename Type>
+constexpr std::string_view TypeKey() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+template <typename Type>
+inline constexpr uint64_t TypeKeyHash = [] {
+  // FNV-1a, so that sorting mostly compares integers rather than long keys
+  uint64_t hash = 14695981039346656037ull;
+  for (const char c : TypeKey<Type>()) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+  }
+  return hash;
+}();
+
+template <typename Variadic>
+struct CategorizedOrderHolder;
+
+template <typename Variadic>
+using CategorizedOrder = typename CategorizedOrderHolder<Variadic>::type;
+
+template <typename... Types>
+struct CategorizedOrderHolder<VariadicHolder<Types...>> {
+  // Groups types by category in order of the categories' first occurrence, keeps the order
+  // of types within a category
+  static constexpr auto Order = [] {
+    constexpr auto category = FirstOccurrences<ErrorCategory<Types>...>;
+    IndexArray<sizeof...(Types)> order{sizeof...(Types)};
+    for (size_t index = 0; index < order.size; ++index) {
+      order.data[index] = index;
+    }
+    std::sort(order.data, order.data + order.size, [&category](size_t lhs, size_t rhs) {
+      return category.data[lhs] != category.data[rhs]
+        ? category.data[lhs] < category.data[rhs]
+        : lhs < rhs;
+    });
+    return order;
+  }();
+
+  using type = SelectIndices<VariadicHolder<Types...>, Order>;
+};
+
+template <typename T>
+struct CategorizedHolder;
+
+template <typename ValueType, typename... ErrorTypes>
+struct CategorizedHolder<ValueOrError<ValueType, ErrorTypes...>> {
+  using type = TransferTemplate<
+    CategorizedOrder<VariadicHolder<ErrorTypes...>>, ValueOrError, ValueType>;
+};
+
+template <typename T>
+using Categorized = typename CategorizedHolder<T>::type;
+
+template <typename Variadic>
+struct CanonicalOrderHolder;
+
+template <typename Variadic>
+using CanonicalOrder = typename CanonicalOrderHolder<Variadic>::type;
+
+template <typename... Types>
+struct CanonicalOrderHolder<VariadicHolder<Types...>> {
+  // Sorts by category and then by TypeKeyHash and TypeKey, so that categories stay contiguous;
+  // types with equal keys keep their relative order
+  static constexpr auto Order = [] {
+    constexpr uint64_t categories[] = {TypeKeyHash<ErrorCategory<Types>>..., 0};
+    constexpr uint64_t hashes[] = {TypeKeyHash<Types>..., 0};
+    IndexArray<sizeof...(Types)> order{sizeof...(Types)};
+    for (size_t index = 0; index < order.size; ++index) {
+      order.data[index] = index;
+    }
+    std::sort(order.data, order.data + order.size, [&](size_t lhs, size_t rhs) {
+      if (categories[lhs] != categories[rhs]) {
+        return categories[lhs] < categories[rhs];
+      }
+      if (hashes[lhs] != hashes[rhs]) {
+        return hashes[lhs] < hashes[rhs];
+      }
+      constexpr std::string_view keys[] = {TypeKey<Types>()..., {}};
+      return keys[lhs] != keys[rhs] ? keys[lhs] < keys[rhs] : lhs < rhs;
+    });
+    return order;
+  }();
+
+  // Whether the distinct types of the same category have distinct keys, otherwise their order
+  // would depend on the order of the arguments
+  static constexpr bool UniqueKeys = [] {
+    constexpr auto first = FirstOccurrences<Types...>;
+    constexpr uint64_t categories[] = {TypeKeyHash<ErrorCategory<Types>>..., 0};
+    constexpr std::string_view keys[] = {TypeKey<Types>()..., {}};
+    for (size_t index = 1; index < Order.size; ++index) {
+      const size_t lhs = Order.data[index - 1];
+      const size_t rhs = Order.data[index];
+      if (categories[lhs] == categories[rhs] && keys[lhs] == keys[rhs]
+          && first.data[lhs] != first.data[rhs]) {
+        return false;
+      }
+    }
+    return true;
+  }();
+
+  using type = SelectIndices<VariadicHolder<Types...>, Order>;
+};
+
+template <typename T>
+struct CanonicalHolder;
+
+template <typename ValueType, typename... ErrorTypes>
+struct CanonicalHolder<ValueOrError<ValueType, ErrorTypes...>> {
+  static_assert(
+      CanonicalOrderHolder<VariadicHolder<ErrorTypes...>>::UniqueKeys,
+      "Canonical can not order distinct error types that are spelled the same");
+
+  using type = TransferTemplate<
+    CanonicalOrder<VariadicHolder<ErrorTypes...>>, ValueOrError, ValueType>;
+};
+
+template <typename T>
+using Canonical = typename CanonicalHolder<T>::type;
+
+}  // namespace detail_
+
+/**
+ * @brief Reorders error types of a ValueOrError type into the canonical order
+ *
+ * The canonical order depends only on the set of error types, so ValueOrError types with
+ * equal error sets become the same type. Conversions between them are plain copies or moves,
+ * and each set is instantiated once.
+ *
+ * For example, consider the following snippet:
+ * @code
+ * static_assert(std::is_same_v<
+ *     Canonical<ValueOrError<float, A, B>>,
+ *     Canonical<ValueOrError<float, B, A>>>);
+ * @endcode
+ *
+ * @note the order is stable across translation units, but otherwise unspecified. It is derived
+ *       from the spelling of the types, so it differs between compilers: code built by GCC and
+ *       by Clang must not exchange Canonical types through an ABI boundary. Distinct types that
+ *       are spelled the same are rejected at compile time.
+ */
+template <typename T>
+using Canonical = detail_::Canonical<T>;
+
+/**
+ * @brief Combine ValueOrError types into the one with the canonical order of error types
+ * @see Union, Canonical
+ */
+template <typename ValueType, typename... VoEOrErrorTypes>
+using CanonicalUnion = Canonical<Union<ValueType, VoEOrErrorTypes...>>;
+
+/**
+ * @brief Reorders error types of a ValueOrError type so that each category is contiguous
+ *
+ * Categories follow the order of their first occurrence, and errors within a category keep
+ * their order. HasErrorIn() on such types is a single range compare on the discriminant.
+ *
+ * For example, consider the following snippet:
+ * @code
+ * struct Retryable {};
+ * struct Timeout { using ErrorCategory = Retryable; };
+ * struct Unavailable { using ErrorCategory = Retryable; };
+ *
+ * using R = Categorized<ValueOrError<int, Timeout, ParseError, Unavailable>>;
+ * static_assert(std::is_same_v<R, ValueOrError<int, Timeout, Unavailable, ParseError>>);
+ *
+ * bool ShouldRetry(const R& r) { return r.HasErrorIn<Retryable>(); }
+ * @endcode
+ *
+ * @see ErrorCategoryTraits
+ * @note Canonical also keeps categories contiguous
+ */
+template <typename T>
+using Categorized = detail_::Categorized<T>;
+
+}  // namespace voe
+
+#endif  // VOE_CANONICAL_HEADER
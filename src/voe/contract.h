@@ -0,0 +1,88 @@
+#ifndef VOE_CONTRACT_HEADER
+#define VOE_CONTRACT_HEADER
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Modes of VOE_CONTRACT_MODE, the handling of violated preconditions
+ *
+ * - VOE_CONTRACT_ASSERT (default): assert(), the checks are removed if NDEBUG is defined;
+ * - VOE_CONTRACT_ABORT: prints the violated condition to stderr and calls std::abort(),
+ *   regardless of NDEBUG;
+ * - VOE_CONTRACT_TRAP: executes a trap instruction, without diagnostics;
+ * - VOE_CONTRACT_LOG: prints the violated condition to stderr and continues, which is
+ *   still undefined behavior for every precondition of the library;
+ * - VOE_CONTRACT_ASSUME: the conditions are not checked, and the optimizer may assume
+ *   them to hold, e.g. that the object holds a value after GetValue().
+ *
+ * The mode must be the same in all translation units of a program.
+ */
+#define VOE_CONTRACT_ASSERT 0
+#define VOE_CONTRACT_ABORT 1
+#define VOE_CONTRACT_TRAP 2
+#define VOE_CONTRACT_LOG 3
+#define VOE_CONTRACT_ASSUME 4
+
+#ifndef VOE_CONTRACT_MODE
+#define VOE_CONTRACT_MODE VOE_CONTRACT_ASSERT
+#endif
+
+// VOE_ASSUME is an expression like the other checks, so the attribute is wrapped into a lambda
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(assume)
+#define VOE_ASSUME(condition) ([&]() noexcept { [[assume(condition)]]; }())
+#endif
+#endif
+
+#ifndef VOE_ASSUME
+#if defined(__clang__)
+#define VOE_ASSUME(condition) __builtin_assume(condition)
+#else
+#define VOE_ASSUME(condition) ((condition) ? void(0) : __builtin_unreachable())
+#endif
+#endif
+
+namespace voe::detail_ {
+
+[[gnu::cold, gnu::noinline]] inline void ReportContractViolation(
+    const char* condition, const char* message, const char* file, int line, const char* function)
+{
+  std::fprintf(
+      stderr, "%s:%d: %s: Contract '%s' violated: %s\n", file, line, function, condition, message);
+}
+
+[[noreturn, gnu::cold, gnu::noinline]] inline void AbortOnContractViolation(
+    const char* condition, const char* message, const char* file, int line, const char* function)
+{
+  ReportContractViolation(condition, message, file, line, function);
+  std::abort();
+}
+
+}  // namespace voe::detail_
+
+/**
+ * @brief Checks the precondition according to VOE_CONTRACT_MODE
+ * @param condition an expression without side effects, that is not evaluated in some modes
+ * @param message a string literal describing the violation
+ */
+#if VOE_CONTRACT_MODE == VOE_CONTRACT_ASSERT
+#define VOE_CONTRACT_CHECK(condition, message) assert((condition) && message)
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_ABORT
+#define VOE_CONTRACT_CHECK(condition, message)                     \
+  ((condition) ? void(0) : ::voe::detail_::AbortOnContractViolation( \
+      #condition, message, __FILE__, __LINE__, __func__))
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_TRAP
+#define VOE_CONTRACT_CHECK(condition, message) ((condition) ? void(0) : __builtin_trap())
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_LOG
+#define VOE_CONTRACT_CHECK(condition, message)                    \
+  ((condition) ? void(0) : ::voe::detail_::ReportContractViolation( \
+      #condition, message, __FILE__, __LINE__, __func__))
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_ASSUME
+#define VOE_CONTRACT_CHECK(condition, message) VOE_ASSUME(condition)
+#else
+#error "Unknown VOE_CONTRACT_MODE"
+#endif
+
+#endif  // VOE_CONTRACT_HEADER
@@ -0,0 +1,2194 @@
+#ifndef VOE_CORE_HEADER
+#define VOE_CORE_HEADER
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "voe/contract.h"
+#include "voe/macros.h"
+
+#if defined(__has_builtin)
+#if __has_builtin(__is_same)
+#define VOE_IS_SAME(A, B) __is_same(A, B)
+#endif
+#if __has_builtin(__type_pack_element)
+#define VOE_HAS_TYPE_PACK_ELEMENT 1
+#endif
+#endif
+
+#ifndef VOE_IS_SAME
+#define VOE_IS_SAME(A, B) std::is_same_v<A, B>
+#endif
+
+#ifndef VOE_HAS_TYPE_PACK_ELEMENT
+#define VOE_HAS_TYPE_PACK_ELEMENT 0
+#endif
+
+namespace voe {
+
+template <typename ValueType, typename... ErrorTypes>
+class [[nodiscard]] ValueOrError;
+
+/**
+ * @brief The category of the error type
+ *
+ * By default, it is ErrorType::ErrorCategory if such member type exists and void otherwise.
+ * Specialize this template to assign a category to an error type that can not be modified.
+ *
+ * @see ValueOrError::HasErrorIn, Categorized
+ */
+template <typename ErrorType>
+struct ErrorCategoryTraits { using type = void; };
+
+template <typename ErrorType>
+  requires requires { typename ErrorType::ErrorCategory; }
+struct ErrorCategoryTraits<ErrorType> { using type = typename ErrorType::ErrorCategory; };
+
+/**
+ * @brief Whether ValueOrError<ValueType, ...> objects never are empty
+ *
+ * Specialize this template as std::true_type to remove the Empty state from every
+ * ValueOrError<ValueType, ErrorTypes...>: such objects always hold either a value or an error,
+ * are not default constructible, and have no Clear(). All the emptiness checks are compiled out
+ * and the discriminant has one alternative less. It is a contract violation to convert an empty
+ * ValueOrError<void, ...> (a success) to such a type, or to discard its held error.
+ * SetError() and EmplaceError() of such types are noexcept.
+ *
+ * The ValueOrError<void, ...> types are not affected, as their Empty state is a success.
+ */
+template <typename ValueType>
+struct NeverEmptyTraits : public std::false_type {};
+
+namespace detail_ {
+
+template <typename From, typename To>
+struct PropagateConstHolder { using type = std::remove_const_t<To>; };
+
+template <typename From, typename To>
+struct PropagateConstHolder<const From, To> { using type = const To; };
+
+template <typename From, typename To>
+struct PropagateConstHolder<const From&, To> { using type = const To; };
+
+template <typename From, typename To>
+struct PropagateConstHolder<const From&&, To> { using type = const To; };
+
+template <typename From, typename To>
+using PropagateConst = typename PropagateConstHolder<From, To>::type;
+
+template <typename... Errors>
+inline constexpr bool AllDecayed = (... && std::is_same_v<Errors, std::decay_t<Errors>>);
+
+template <typename Type>
+struct TypeSetElement {};
+
+template <size_t Index, typename Type>
+struct IndexedTypeSetElement : public TypeSetElement<Type> {};
+
+template <typename Sequence, typename... Types>
+struct TypeSetHolder;
+
+template <size_t... Indices, typename... Types>
+struct TypeSetHolder<std::index_sequence<Indices...>, Types...>
+  : public IndexedTypeSetElement<Indices, Types>... {};
+
+// Duplicates only make the base ambiguous, which std::is_base_of does not care about
+template <typename... Types>
+using TypeSet = TypeSetHolder<std::index_sequence_for<Types...>, Types...>;
+
+template <typename Type, typename... Types>
+inline constexpr bool TypesContain = std::is_base_of_v<TypeSetElement<Type>, TypeSet<Types...>>;
+
+#if VOE_HAS_TYPE_PACK_ELEMENT
+
+template <size_t Index, typename... Types>
+using IndexToType = __type_pack_element<Index, Types...>;
+
+#else
+
+template <size_t Index, typename Type>
+struct IndexedType { using type = Type; };
+
+template <typename Sequence, typename... Types>
+struct IndexedTypes;
+
+template <size_t... Indices, typename... Types>
+struct IndexedTypes<std::index_sequence<Indices...>, Types...>
+  : public IndexedType<Indices, Types>... {};
+
+template <size_t Index, typename Type>
+IndexedType<Index, Type> SelectIndexedType(const IndexedType<Index, Type>&);
+
+template <size_t Index, typename... Types>
+using IndexToType = typename decltype(SelectIndexedType<Index>(
+  std::declval<IndexedTypes<std::index_sequence_for<Types...>, Types...>>()))::type;
+
+#endif
+
+template <typename Type, typename... Types>
+constexpr size_t FindFirst() noexcept {
+  constexpr bool matches[] = {VOE_IS_SAME(Type, Types)..., false};
+  for (size_t index = 0; index < sizeof...(Types); ++index) {
+    if (matches[index]) {
+      return index;
+    }
+  }
+  return size_t(-1);
+}
+
+template <typename Type, typename... Types>
+inline constexpr size_t TypeToIndex = FindFirst<Type, Types...>();
+
+template <size_t Capacity>
+struct IndexArray {
+  size_t size{0};
+  size_t data[Capacity + 1]{};
+};
+
+template <typename... Types>
+inline constexpr IndexArray<sizeof...(Types)> FirstOccurrences{
+  sizeof...(Types), {FindFirst<Types, Types...>()...}};
+
+template <typename... Types>
+inline constexpr bool AllUnique = [] {
+  constexpr auto first = FirstOccurrences<Types...>;
+  for (size_t index = 0; index < first.size; ++index) {
+    if (first.data[index] != index) {
+      return false;
+    }
+  }
+  return true;
+}();
+
+template <
+  typename FromTemplate,
+  template <typename...> class ToTemplate,
+  typename... HeadArgs>
+struct TransferTemplateHolder;
+
+template <
+  template <typename...> class FromTemplate,
+  template <typename...> class ToTemplate,
+  typename... Args, typename... HeadArgs>
+struct TransferTemplateHolder<FromTemplate<Args...>, ToTemplate, HeadArgs...> {
+  using type = ToTemplate<HeadArgs..., Args...>;
+};
+
+template <typename FromTemplate, template <typename...> class ToTemplate, typename... HeadArgs>
+using TransferTemplate =
+  typename TransferTemplateHolder<FromTemplate, ToTemplate, HeadArgs...>::type;
+
+template <typename Callable, typename... Types>
+struct VisitInvokeResultHolder;
+
+template <typename Callable, typename T, typename... Types>
+struct VisitInvokeResultHolder<Callable, T, Types...> {
+  using type = std::invoke_result_t<Callable, T>;
+};
+
+template <typename Callable>
+struct VisitInvokeResultHolder<Callable> {
+  using type = std::invoke_result_t<Callable>;
+};
+
+template <typename Callable, typename... Types>
+using VisitInvokeResult = typename VisitInvokeResultHolder<Callable, Types...>::type;
+
+template <typename... Types>
+struct VariadicHolder;
+
+template <typename... Ts1, typename... Ts2>
+VariadicHolder<Ts1..., Ts2...>& operator+(VariadicHolder<Ts1...>&, VariadicHolder<Ts2...>&);
+
+template <typename... Ts>
+using Concat = std::remove_reference_t<
+  decltype((std::declval<VariadicHolder<>&>() + ... + std::declval<Ts&>()))>;
+
+template <
+  typename Variadic, auto Indices, typename Sequence = std::make_index_sequence<Indices.size>>
+struct SelectIndicesHolder;
+
+template <typename... Types, auto Indices, size_t... I>
+struct SelectIndicesHolder<VariadicHolder<Types...>, Indices, std::index_sequence<I...>> {
+  using type = VariadicHolder<IndexToType<Indices.data[I], Types...>...>;
+};
+
+template <typename Variadic, auto Indices>
+using SelectIndices = typename SelectIndicesHolder<Variadic, Indices>::type;
+
+template <typename Ts>
+struct RemoveDuplicatesHolder;
+
+template <typename... Ts>
+using RemoveDuplicates = typename RemoveDuplicatesHolder<Ts...>::type;
+
+template <typename... Ts>
+struct RemoveDuplicatesHolder<VariadicHolder<Ts...>> {
+  // Keeps the last occurrence of each type
+  static constexpr auto LastOccurrences = [] {
+    constexpr auto first = FirstOccurrences<Ts...>;
+    bool seen[sizeof...(Ts) + 1]{};
+    bool is_last[sizeof...(Ts) + 1]{};
+    for (size_t index = first.size; index-- > 0;) {
+      is_last[index] = !seen[first.data[index]];
+      seen[first.data[index]] = true;
+    }
+
+    IndexArray<sizeof...(Ts)> last;
+    for (size_t index = 0; index < first.size; ++index) {
+      if (is_last[index]) {
+        last.data[last.size++] = index;
+      }
+    }
+    return last;
+  }();
+
+  using type = SelectIndices<VariadicHolder<Ts...>, LastOccurrences>;
+};
+
+template <typename... Ts>
+using Union = RemoveDuplicates<Concat<Ts...>>;
+
+template <typename T>
+struct ErrorTypesHolder { using type = VariadicHolder<T>; };
+
+template <typename ValueType, typename... ErrorTypes>
+struct ErrorTypesHolder<ValueOrError<ValueType, ErrorTypes...>> {
+  using type = VariadicHolder<ErrorTypes...>;
+};
+
+template <typename T>
+using ErrorTypes = typename ErrorTypesHolder<T>::type;
+
+template <typename ValueType, typename... VoEOrErrorTypes>
+using UnionValueOrError = TransferTemplate<
+  Union<ErrorTypes<VoEOrErrorTypes>...>,
+  ValueOrError, ValueType
+>;
+
+template <typename ErrorType>
+using ErrorCategory = typename ErrorCategoryTraits<ErrorType>::type;
+
+template <typename T>
+struct FlatHolder { using type = T; };
+
+template <typename ValueType, typename... InnerErrorTypes, typename... OuterErrorTypes>
+struct FlatHolder<ValueOrError<ValueOrError<ValueType, InnerErrorTypes...>, OuterErrorTypes...>> {
+  using type = typename FlatHolder<TransferTemplate<
+    Union<VariadicHolder<InnerErrorTypes...>, VariadicHolder<OuterErrorTypes...>>,
+    ValueOrError, ValueType>>::type;
+};
+
+template <typename T>
+using Flat = typename FlatHolder<T>::type;
+
+template <typename T>
+struct IsValueOrErrorHolder : public std::false_type {};
+
+template <typename ValueType, typename... ErrorTypes>
+struct IsValueOrErrorHolder<ValueOrError<ValueType, ErrorTypes...>> : public std::true_type {};
+
+template <typename T>
+inline constexpr bool IsValueOrError = IsValueOrErrorHolder<std::remove_cvref_t<T>>::value;
+
+// Whether T is ValueOrError<ValueType, ...>
+template <typename T, typename ValueType>
+inline constexpr bool IsValueOrErrorOf = false;
+
+template <typename ValueType, typename... ErrorTypes>
+inline constexpr bool IsValueOrErrorOf<ValueOrError<ValueType, ErrorTypes...>, ValueType> = true;
+
+template <typename Variadic, typename... Remove>
+struct RemoveTypesHolder;
+
+template <typename Variadic, typename... Remove>
+using RemoveTypes = typename RemoveTypesHolder<Variadic, Remove...>::type;
+
+template <typename... Types, typename... Remove>
+struct RemoveTypesHolder<VariadicHolder<Types...>, Remove...> {
+  static constexpr auto Kept = [] {
+    constexpr bool remove[] = {TypesContain<Types, Remove...>..., false};
+    IndexArray<sizeof...(Types)> kept;
+    for (size_t index = 0; index < sizeof...(Types); ++index) {
+      if (!remove[index]) {
+        kept.data[kept.size++] = index;
+      }
+    }
+    return kept;
+  }();
+
+  using type = SelectIndices<VariadicHolder<Types...>, Kept>;
+};
+
+template <typename HolderA, typename HolderB>
+struct SubsetOf;
+
+template <typename... TypesA, typename... TypesB>
+struct SubsetOf<VariadicHolder<TypesA...>, VariadicHolder<TypesB...>> {
+  static constexpr bool value = (... && TypesContain<TypesA, TypesB...>);
+};
+
+template <typename... TypesFrom>
+struct IndexMapping {
+  template <typename... TypesTo>
+  struct MapTo {
+    static constexpr size_t indices[sizeof...(TypesFrom)] ={
+      TypeToIndex<TypesFrom, TypesTo...>...
+    };
+  };
+
+  template <typename... TypesTo>
+  struct MapTo<VariadicHolder<TypesTo...>> : public MapTo<TypesTo...> {};
+};
+
+template <typename... TypesFrom>
+struct IndexMapping<VariadicHolder<TypesFrom...>> : public IndexMapping<TypesFrom...> {};
+
+template <uint64_t NumVariants, std::integral... Types>
+struct MinimalSizedIndexTypeHolder;
+
+template <uint64_t NumVariants, std::integral Type, std::integral... Types>
+  requires (NumVariants <= static_cast<uint64_t>(std::numeric_limits<Type>::max()))
+struct MinimalSizedIndexTypeHolder<NumVariants, Type, Types...> {
+  using type = Type;
+};
+
+template <uint64_t NumVariants, std::integral Type, std::integral... Types>
+  requires (NumVariants > static_cast<uint64_t>(std::numeric_limits<Type>::max()))
+struct MinimalSizedIndexTypeHolder<NumVariants, Type, Types...> {
+  using type = typename MinimalSizedIndexTypeHolder<NumVariants, Types...>::type;
+};
+
+template <size_t NumVariants>
+using MinimalSizedIndexType =
+  typename MinimalSizedIndexTypeHolder<NumVariants, uint8_t, uint16_t, uint32_t, uint64_t>::type;
+
+template <typename FromVariadic, typename ToVariadic>
+struct ConvertibleHolder : public std::false_type {};
+
+template <
+  typename FromValueType, typename... FromErrorTypes,
+  typename ValueType, typename... ErrorTypes>
+struct ConvertibleHolder<
+  VariadicHolder<FromValueType, FromErrorTypes...>,
+  VariadicHolder<ValueType, ErrorTypes...>>
+{
+  static constexpr bool value = (
+      std::is_same_v<void, FromValueType> ||
+      std::is_same_v<ValueType, void> ||
+      std::is_same_v<ValueType, FromValueType>
+    ) && (
+      SubsetOf<
+        VariadicHolder<FromErrorTypes...>,
+        VariadicHolder<ErrorTypes...>>::value
+    );
+};
+
+template <typename FromVariadic, typename ToVariadic>
+inline constexpr bool Convertible = ConvertibleHolder<FromVariadic, ToVariadic>::value;
+
+template <typename Self, typename Type>
+constexpr auto&& ForwardLike(Type& ref) noexcept {
+  if constexpr (std::is_lvalue_reference_v<Self>) {
+    return ref;
+  } else {
+    return std::move(ref);
+  }
+}
+
+template <typename From, typename Type>
+using ForwardLikeType = decltype(ForwardLike<From>(std::declval<PropagateConst<From, Type>&>()));
+
+template <typename From, typename Type>
+inline constexpr bool ConstructibleLikeOne =
+  std::is_constructible_v<Type, ForwardLikeType<From, Type>>;
+
+template <typename From>
+inline constexpr bool ConstructibleLikeOne<From, void> = true;
+
+template <typename From, typename Type>
+inline constexpr bool AssignableLikeOne =
+  ConstructibleLikeOne<From, Type> && std::is_assignable_v<Type&, ForwardLikeType<From, Type>>;
+
+template <typename From>
+inline constexpr bool AssignableLikeOne<From, void> = true;
+
+template <typename From, typename... Types>
+inline constexpr bool ConstructibleLike = (... && ConstructibleLikeOne<From, Types>);
+
+template <typename From, typename... Types>
+inline constexpr bool AssignableLike = (... && AssignableLikeOne<From, Types>);
+
+// The value of From is only transferred if ToValueType is not void
+template <
+  typename From, typename ToValueType,
+  typename Variadic = TransferTemplate<std::decay_t<From>, VariadicHolder>>
+inline constexpr bool AlternativesConstructibleLike = false;
+
+template <typename From, typename ToValueType, typename ValueType, typename... ErrorTypes>
+inline constexpr bool AlternativesConstructibleLike<
+    From, ToValueType, VariadicHolder<ValueType, ErrorTypes...>> =
+  ConstructibleLikeOne<From, std::conditional_t<std::is_void_v<ToValueType>, void, ValueType>> &&
+  ConstructibleLike<From, ErrorTypes...>;
+
+template <
+  typename From, typename ToValueType,
+  typename Variadic = TransferTemplate<std::decay_t<From>, VariadicHolder>>
+inline constexpr bool AlternativesAssignableLike = false;
+
+template <typename From, typename ToValueType, typename ValueType, typename... ErrorTypes>
+inline constexpr bool AlternativesAssignableLike<
+    From, ToValueType, VariadicHolder<ValueType, ErrorTypes...>> =
+  AssignableLikeOne<From, std::conditional_t<std::is_void_v<ToValueType>, void, ValueType>> &&
+  AssignableLike<From, ErrorTypes...>;
+
+template <typename... Types>
+inline constexpr bool AllCopyConstructible =
+  ConstructibleLike<const VariadicHolder<Types...>&, Types...>;
+
+// The unions of a tree are trivially destructible if all of its types are, and have an empty
+// destructor otherwise (the active member is destroyed by the owner of the tree)
+template <bool Trivial, typename Type>
+union StorageLeaf {
+  constexpr StorageLeaf() noexcept {}
+
+  Type value;
+};
+
+template <typename Type>
+union StorageLeaf<false, Type> {
+  constexpr StorageLeaf() noexcept {}
+  constexpr ~StorageLeaf() {}
+
+  Type value;
+};
+
+template <bool Trivial, typename Left, typename Right>
+union StorageNode {
+  constexpr StorageNode() noexcept {}
+
+  Left left;
+  Right right;
+};
+
+template <typename Left, typename Right>
+union StorageNode<false, Left, Right> {
+  constexpr StorageNode() noexcept {}
+  constexpr ~StorageNode() {}
+
+  Left left;
+  Right right;
+};
+
+// Pairs the adjacent nodes of a tree level, keeping their order (an odd last node is carried
+// over to the next level as is)
+template <bool Trivial, typename Paired, typename... Nodes>
+struct PairNodesHolder;
+
+template <bool Trivial, typename... Paired>
+struct PairNodesHolder<Trivial, VariadicHolder<Paired...>> {
+  using type = VariadicHolder<Paired...>;
+};
+
+template <bool Trivial, typename... Paired, typename Node>
+struct PairNodesHolder<Trivial, VariadicHolder<Paired...>, Node> {
+  using type = VariadicHolder<Paired..., Node>;
+};
+
+template <bool Trivial, typename... Paired, typename A, typename B, typename... Nodes>
+struct PairNodesHolder<Trivial, VariadicHolder<Paired...>, A, B, Nodes...>
+  : PairNodesHolder<Trivial, VariadicHolder<Paired..., StorageNode<Trivial, A, B>>, Nodes...> {};
+
+// Eight nodes at a time, to keep the recursion depth low for large packs
+template <
+  bool Trivial, typename... Paired,
+  typename A0, typename B0, typename A1, typename B1,
+  typename A2, typename B2, typename A3, typename B3,
+  typename... Nodes>
+struct PairNodesHolder<
+    Trivial, VariadicHolder<Paired...>, A0, B0, A1, B1, A2, B2, A3, B3, Nodes...>
+  : PairNodesHolder<
+      Trivial,
+      VariadicHolder<
+        Paired..., StorageNode<Trivial, A0, B0>, StorageNode<Trivial, A1, B1>,
+        StorageNode<Trivial, A2, B2>, StorageNode<Trivial, A3, B3>>,
+      Nodes...> {};
+
+template <bool Trivial, typename Level>
+struct StorageTreeHolder;
+
+template <bool Trivial>
+struct StorageTreeHolder<Trivial, VariadicHolder<>> {
+  union type {
+    constexpr type() noexcept {}
+  };
+};
+
+template <bool Trivial, typename Root>
+struct StorageTreeHolder<Trivial, VariadicHolder<Root>> { using type = Root; };
+
+template <bool Trivial, typename... Nodes>
+struct StorageTreeHolder<Trivial, VariadicHolder<Nodes...>>
+  : StorageTreeHolder<
+      Trivial, typename PairNodesHolder<Trivial, VariadicHolder<>, Nodes...>::type> {};
+
+// A balanced tree of unions, so that the nesting depth is logarithmic in the number of types.
+// It is built bottom-up by pairing the adjacent nodes, so the leaves stay in the order of the
+// types, and no type is looked up by its index.
+template <typename Variadic>
+struct StorageLeavesHolder;
+
+template <typename... Types>
+struct StorageLeavesHolder<VariadicHolder<Types...>> {
+  static constexpr bool Trivial = (... && std::is_trivially_destructible_v<Types>);
+
+  using type = typename StorageTreeHolder<
+    Trivial, VariadicHolder<StorageLeaf<Trivial, Types>...>>::type;
+};
+
+template <typename Variadic>
+using StorageTree = typename StorageLeavesHolder<Variadic>::type;
+
+template <typename Tree>
+struct StorageTreeSize { static constexpr size_t value = 1; };
+
+template <bool Trivial, typename Left, typename Right>
+struct StorageTreeSize<StorageNode<Trivial, Left, Right>> {
+  static constexpr size_t value = StorageTreeSize<Left>::value + StorageTreeSize<Right>::value;
+};
+
+template <typename Tree>
+inline constexpr bool IsStorageLeaf = false;
+
+template <bool Trivial, typename Type>
+inline constexpr bool IsStorageLeaf<StorageLeaf<Trivial, Type>> = true;
+
+/**
+ * @return a reference to the Index-th type of the tree (with the same constness)
+ */
+template <size_t Index, typename Tree>
+constexpr auto& Get(Tree& tree) noexcept {
+  if constexpr (IsStorageLeaf<std::remove_const_t<Tree>>) {
+    return tree.value;
+  } else if constexpr (Index < StorageTreeSize<std::remove_const_t<decltype(tree.left)>>::value) {
+    return Get<Index>(tree.left);
+  } else {
+    return Get<Index - StorageTreeSize<std::remove_const_t<decltype(tree.left)>>::value>(
+        tree.right);
+  }
+}
+
+/**
+ * @brief Makes the unions on the path to the Index-th type of the tree active
+ *
+ * @return a reference to the Index-th type of the tree, which is not constructed yet
+ */
+template <size_t Index, typename Tree>
+constexpr auto& Activate(Tree& tree) noexcept {
+  if constexpr (IsStorageLeaf<Tree>) {
+    return tree.value;
+  } else if constexpr (Index < StorageTreeSize<decltype(tree.left)>::value) {
+    std::construct_at(&tree.left);
+    return Activate<Index>(tree.left);
+  } else {
+    std::construct_at(&tree.right);
+    return Activate<Index - StorageTreeSize<decltype(tree.left)>::value>(tree.right);
+  }
+}
+
+/**
+ * @brief Constructs the Index-th type of the tree making it the active member
+ */
+template <size_t Index, typename Tree, typename... Args>
+constexpr void Emplace(Tree& tree, Args&&... args) {
+  std::construct_at(&Activate<Index>(tree), std::forward<Args>(args)...);
+}
+
+template <typename Result, typename Callable, size_t Index>
+constexpr Result DispatchThunk(Callable& callable) {
+  return std::forward<Callable>(callable)(std::integral_constant<size_t, Index>{});
+}
+
+template <typename Result, typename Callable, size_t Index>
+[[gnu::cold, gnu::noinline]] constexpr Result ColdDispatchThunk(Callable& callable) {
+  return std::forward<Callable>(callable)(std::integral_constant<size_t, Index>{});
+}
+
+template <typename Result, typename Callable, size_t HotCount, typename Sequence>
+struct DispatchTable;
+
+template <typename Result, typename Callable, size_t HotCount, size_t... Indices>
+struct DispatchTable<Result, Callable, HotCount, std::index_sequence<Indices...>> {
+  using Function = Result (*)(Callable&);
+
+  // Only the selected thunk is instantiated for each index
+  template <size_t Index>
+  static constexpr Function Thunk() {
+    if constexpr (Index < HotCount) {
+      return DispatchThunk<Result, Callable, Index>;
+    } else {
+      return ColdDispatchThunk<Result, Callable, Index>;
+    }
+  }
+
+  static constexpr Function array[sizeof...(Indices)] = {Thunk<Indices>()...};
+};
+
+/**
+ * @brief Calls the callable with std::integral_constant<size_t, index> through a function table
+ *
+ * All calls must return the same type. The alternatives starting from HotCount (the errors)
+ * are expected to be rare and are called through cold, outlined thunks. If the only hot
+ * alternative is the first one (the value), it is called directly, without the table.
+ */
+template <size_t Size, size_t HotCount = Size, typename Callable>
+constexpr decltype(auto) Dispatch(size_t index, Callable&& callable) {
+  if constexpr (Size == 0) {
+    VOE_CONTRACT_CHECK(false, "Dispatch() called with no alternatives");
+    __builtin_unreachable();
+  } else {
+    using Result = std::invoke_result_t<Callable, std::integral_constant<size_t, 0>>;
+    using Table = DispatchTable<Result, Callable, HotCount, std::make_index_sequence<Size>>;
+    if constexpr (HotCount == 1 && Size > 1) {
+      if (index == 0) [[likely]] {
+        return DispatchThunk<Result, Callable, 0>(callable);
+      }
+    }
+    return Table::array[index](callable);
+  }
+}
+
+// If Activating is set, the path to the index-th alternative of the first tree is made active,
+// and the alternative itself is left for the callable to construct
+template <
+  typename Result, size_t Offset, bool Activating, typename Callable,
+  typename Tree, typename... Trees>
+constexpr Result DescendStorage(size_t index, Callable& callable, Tree& tree, Trees&... trees) {
+  if constexpr (IsStorageLeaf<std::remove_const_t<Tree>>) {
+    return std::forward<Callable>(callable)(
+        std::integral_constant<size_t, Offset>{}, tree.value, trees.value...);
+  } else {
+    constexpr size_t middle =
+      Offset + StorageTreeSize<std::remove_const_t<decltype(tree.left)>>::value;
+    if (index < middle) {
+      if constexpr (Activating) {
+        std::construct_at(&tree.left);
+      }
+      return DescendStorage<Result, Offset, Activating>(
+          index, callable, tree.left, trees.left...);
+    }
+    if constexpr (Activating) {
+      std::construct_at(&tree.right);
+    }
+    return DescendStorage<Result, middle, Activating>(index, callable, tree.right, trees.right...);
+  }
+}
+
+template <typename Result, bool Activating, typename Callable, typename... Trees>
+[[gnu::cold, gnu::noinline]] constexpr Result ColdDescendStorage(
+    size_t index, Callable& callable, Trees&... trees)
+{
+  return DescendStorage<Result, 0, Activating>(index, callable, trees...);
+}
+
+// Dispatches the descent to the hot or cold path, see VisitStorage
+template <size_t Size, size_t HotCount, bool Activating, typename Callable, typename... Trees>
+constexpr decltype(auto) DescendStorageFrom(size_t index, Callable&& callable, Trees&... trees) {
+  if constexpr (Size == 0) {
+    VOE_CONTRACT_CHECK(false, "VisitStorage() called with no alternatives");
+    __builtin_unreachable();
+  } else {
+    using Result = std::invoke_result_t<
+      Callable, std::integral_constant<size_t, 0>, decltype(Get<0>(trees))...>;
+    if constexpr (HotCount == 1 && Size > 1) {
+      if (index == 0) [[likely]] {
+        if constexpr (Activating) {
+          return [&callable](auto& target, auto&... rest) -> Result {
+            return std::forward<Callable>(callable)(
+                std::integral_constant<size_t, 0>{}, Activate<0>(target), Get<0>(rest)...);
+          }(trees...);
+        } else {
+          return std::forward<Callable>(callable)(
+              std::integral_constant<size_t, 0>{}, Get<0>(trees)...);
+        }
+      }
+    }
+    if constexpr (HotCount == 0 || (HotCount == 1 && Size > 1)) {
+      return ColdDescendStorage<Result, Activating>(index, callable, trees...);
+    } else {
+      return DescendStorage<Result, 0, Activating>(index, callable, trees...);
+    }
+  }
+}
+
+/**
+ * @brief Calls the callable with std::integral_constant<size_t, index> and references to the
+ * index-th alternatives of the trees
+ *
+ * The trees must have the same shape (they may differ in constness), and the index-th
+ * alternative must be the active one in all of them. The trees are descended along the index,
+ * so every tree node is visited by a single function whatever the number of alternatives,
+ * instead of a table entry and an accessor chain per alternative as with Dispatch.
+ *
+ * All calls must return the same type. The alternatives starting from HotCount (the errors)
+ * are expected to be rare and are visited by a cold, outlined function. If the only hot
+ * alternative is the first one (the value), it is visited directly.
+ */
+template <size_t Size, size_t HotCount = Size, typename Callable, typename... Trees>
+constexpr decltype(auto) VisitStorage(size_t index, Callable&& callable, Trees&... trees) {
+  return DescendStorageFrom<Size, HotCount, false>(
+      index, std::forward<Callable>(callable), trees...);
+}
+
+/**
+ * @brief Like VisitStorage, but the index-th alternative of the target tree is not constructed
+ * yet, and is passed for the callable to construct (e.g. with std::construct_at)
+ */
+template <
+  size_t Size, size_t HotCount = Size, typename Callable, typename Target, typename... Trees>
+constexpr void EmplaceStorage(size_t index, Callable&& callable, Target& target, Trees&... trees) {
+  DescendStorageFrom<Size, HotCount, true>(
+      index, std::forward<Callable>(callable), target, trees...);
+}
+
+template <bool NeverEmpty, typename... Types>
+struct VariantStorage {
+  // The index reuses the tail padding of the tree if the tree has some (e.g. an int and a
+  // struct of 7 chars take 8 bytes). Otherwise it is placed after the tree, e.g. two 16-byte
+  // types aligned to 8 take 24 bytes.
+  [[no_unique_address]] StorageTree<VariadicHolder<Types...>> data;
+  MinimalSizedIndexType<(NeverEmpty ? 0 : 1) + sizeof...(Types)> index{0};
+};
+
+template <typename Type>
+struct ValueTypeWrapper {};
+
+template <bool NeverEmptyFlag, typename... Stored>
+struct TraitsBase : public VariantStorage<NeverEmptyFlag, Stored...> {
+ public:
+  using StorageType = VariantStorage<NeverEmptyFlag, Stored...>;
+
+  static constexpr size_t StoredCount = sizeof...(Stored);
+
+  // Never empty objects have no logical index reserved for the Empty state
+  static constexpr bool NeverEmpty = NeverEmptyFlag;
+
+  template <size_t Index>
+  using StoredType = IndexToType<Index, Stored...>;
+
+  constexpr const auto& LogicalIndex() const noexcept { return StorageType::index; }
+  constexpr auto& LogicalIndex() noexcept { return StorageType::index; }
+  constexpr size_t PhysicalIndex() const noexcept {
+    return LogicalToPhysicalIndex(LogicalIndex());
+  }
+
+  constexpr const auto& Data() const noexcept { return StorageType::data; }
+  constexpr auto& Data() noexcept { return StorageType::data; }
+
+  static constexpr size_t LogicalEmptyIndex() noexcept requires (!NeverEmpty) { return 0; }
+  static constexpr size_t LogicalToPhysicalIndex(size_t index) noexcept {
+    return index - (NeverEmpty ? 0 : 1);
+  }
+  static constexpr size_t PhysicalToLogicalIndex(size_t index) noexcept {
+    return index + (NeverEmpty ? 0 : 1);
+  }
+
+  /**
+   * @return whether this object neither holds a value nor an error (is empty)
+   */
+  constexpr bool IsEmpty() const noexcept {
+    if constexpr (NeverEmpty) {
+      return false;
+    } else {
+      return LogicalIndex() == LogicalEmptyIndex();
+    }
+  }
+
+ private:
+  using StorageType::index;
+  using StorageType::data;
+};
+
+template <typename... Types>
+struct Traits;
+
+template <typename ValueType, typename... ErrorTypes>
+struct Traits<ValueType, ErrorTypes...>
+  : public TraitsBase<NeverEmptyTraits<ValueType>::value, ValueType, ErrorTypes...>
+{
+  using Base = TraitsBase<NeverEmptyTraits<ValueType>::value, ValueType, ErrorTypes...>;
+
+  using StoredTypes = VariadicHolder<ValueTypeWrapper<ValueType>, ErrorTypes...>;
+  using StoredErrorTypes = VariadicHolder<ErrorTypes...>;
+
+  // The value is the only alternative expected on the happy path, see Dispatch
+  static constexpr size_t HotStoredCount = 1;
+
+  static constexpr size_t LogicalValueIndex() noexcept { return Base::PhysicalToLogicalIndex(0); }
+  static constexpr size_t LogicalFirstErrorIndex() noexcept {
+    return Base::PhysicalToLogicalIndex(1);
+  }
+
+  template <typename ErrorType> requires TypesContain<ErrorType, ErrorTypes...>
+  static constexpr size_t LogicalErrorIndex() noexcept {
+    return LogicalFirstErrorIndex() + TypeToIndex<ErrorType, ErrorTypes...>;
+  }
+
+  template <typename ErrorType> requires TypesContain<ErrorType, ErrorTypes...>
+  static constexpr size_t PhysicalErrorIndex() noexcept {
+    return Base::LogicalToPhysicalIndex(LogicalErrorIndex<ErrorType>());
+  }
+};
+
+template <typename... ErrorTypes>
+struct Traits<void, ErrorTypes...> : public TraitsBase<false, ErrorTypes...> {
+  using Base = TraitsBase<false, ErrorTypes...>;
+
+  using StoredTypes = VariadicHolder<ErrorTypes...>;
+  using StoredErrorTypes = VariadicHolder<ErrorTypes...>;
+
+  static constexpr size_t HotStoredCount = 0;
+
+  static constexpr size_t LogicalFirstErrorIndex() noexcept { return 1; }
+
+  template <typename ErrorType> requires TypesContain<ErrorType, ErrorTypes...>
+  static constexpr size_t LogicalErrorIndex() noexcept {
+    return LogicalFirstErrorIndex() + TypeToIndex<ErrorType, ErrorTypes...>;
+  }
+
+  template <typename ErrorType> requires TypesContain<ErrorType, ErrorTypes...>
+  static constexpr size_t PhysicalErrorIndex() noexcept {
+    return Base::LogicalToPhysicalIndex(LogicalErrorIndex<ErrorType>());
+  }
+};
+
+template <size_t Size>
+struct IndexSet {
+  size_t first{size_t(-1)};
+  size_t last{0};
+  size_t count{0};
+  uint64_t words[Size / 64 + 1]{};
+
+  constexpr void Insert(size_t index) noexcept {
+    if (Contains(index)) {
+      return;
+    }
+    words[index / 64] |= uint64_t(1) << (index % 64);
+    first = index < first ? index : first;
+    last = index > last ? index : last;
+    ++count;
+  }
+
+  constexpr bool Contains(size_t index) const noexcept {
+    return index < Size && ((words[index / 64] >> (index % 64)) & 1) != 0;
+  }
+
+  constexpr bool Contiguous() const noexcept { return last + 1 - first == count; }
+};
+
+/**
+ * @return whether the index is in the set
+ * @note compiles to a single range compare if the set is contiguous, and to a bit test otherwise
+ */
+template <size_t Size, IndexSet<Size> Set>
+constexpr bool InIndexSet(size_t index) noexcept {
+  if constexpr (Set.count == 0) {
+    return false;
+  } else if constexpr (Set.Contiguous()) {
+    return index - Set.first < Set.count;
+  } else if constexpr (Size <= 64) {
+    return ((Set.words[0] >> index) & 1) != 0;
+  } else {
+    return Set.Contains(index);
+  }
+}
+
+template <typename Traits, typename... ErrorTypes>
+struct ErrorIndexSets {
+  static constexpr size_t Size = Traits::LogicalFirstErrorIndex() + sizeof...(ErrorTypes);
+
+  template <typename... Selected>
+  static constexpr IndexSet<Size> Of = [] {
+    IndexSet<Size> set;
+    (set.Insert(Traits::template LogicalErrorIndex<Selected>()), ...);
+    return set;
+  }();
+
+  template <typename Category>
+  static constexpr IndexSet<Size> In = [] {
+    IndexSet<Size> set;
+    size_t index = Traits::LogicalFirstErrorIndex();
+    (..., (VOE_IS_SAME(Category, ErrorCategory<ErrorTypes>) ? set.Insert(index++) : void(++index)));
+    return set;
+  }();
+};
+
+template <typename... Types>
+inline constexpr bool AllTriviallyDestructible =
+  (... && (std::is_trivially_destructible_v<Types> || VOE_IS_SAME(void, Types)));
+
+template <typename... Types>
+struct DestructorImpl : public Traits<Types...> {
+  using Base = Traits<Types...>;
+
+  constexpr ~DestructorImpl() noexcept requires AllTriviallyDestructible<Types...> = default;
+  constexpr ~DestructorImpl() noexcept {
+    DestroyImpl();
+  }
+
+  /**
+   * @brief Clears the object. The state after method is applied is Empty.
+   * @note never empty objects are only destroyed, and must be refilled right away
+   */
+  constexpr void Clear() noexcept {
+    if constexpr (!AllTriviallyDestructible<Types...>) {
+      DestroyImpl();
+    }
+    if constexpr (!Base::NeverEmpty) {
+      Base::LogicalIndex() = Base::LogicalEmptyIndex();
+    }
+  }
+
+ private:
+  constexpr void DestroyImpl() noexcept {
+    if (Base::IsEmpty()) {
+      return;
+    }
+    VisitStorage<Base::StoredCount, Base::HotStoredCount>(
+        Base::PhysicalIndex(), [](auto, auto& stored) { std::destroy_at(&stored); }, Base::Data());
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct GetValueImpl : public DestructorImpl<ValueType, ErrorTypes...> {
+  using Base = DestructorImpl<ValueType, ErrorTypes...>;
+
+  /**
+   * @return whether the object holds a value.
+   */
+  constexpr bool HasValue() const noexcept {
+    return Base::LogicalIndex() == Base::LogicalValueIndex();
+  }
+
+  /**
+   * @return a reference to underlying value
+   * @exception UB is HasValue() == false
+   */
+  constexpr ValueType& GetValue() & noexcept {
+    VOE_CONTRACT_CHECK(HasValue(), "GetValue() called on object with no value");
+    return Get<0>(Base::Data());
+  }
+
+  /**
+   * @return moved underlying value
+   * @exception UB is HasValue() == false
+   */
+  constexpr ValueType&& GetValue() && noexcept {
+    VOE_CONTRACT_CHECK(HasValue(), "GetValue() called on object with no value");
+    return std::move(Get<0>(Base::Data()));
+  }
+
+  /**
+   * @return a const reference to underlying value
+   * @exception UB is HasValue() == false
+   */
+  constexpr const ValueType& GetValue() const& noexcept {
+    VOE_CONTRACT_CHECK(HasValue(), "GetValue() called on object with no value");
+    return Get<0>(Base::Data());
+  }
+};
+
+template <typename... ErrorTypes>
+struct GetValueImpl<void, ErrorTypes...> : public DestructorImpl<void, ErrorTypes...> {
+  using Base = DestructorImpl<void, ErrorTypes...>;
+
+  /**
+   * @return false
+   * @note ValueOrError<void, ...> never holds a value
+   */
+  constexpr bool HasValue() const noexcept { return false; }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct GetErrorImpl : public GetValueImpl<ValueType, ErrorTypes...> {
+  using Base = GetValueImpl<ValueType, ErrorTypes...>;
+
+  /**
+   * @brief Get Error type by its index in ErrorTypes... list
+   */
+  template <size_t Index>
+  using ErrorType = IndexToType<Index, ErrorTypes...>;
+
+  /**
+   * @return whether the object holds any error
+   */
+  constexpr bool HasAnyError() const noexcept {
+    return Base::LogicalIndex() >= Base::LogicalFirstErrorIndex();
+  }
+
+  /**
+   * @return the index of underlying error in ErrorTypes... list
+   * @exception UB if !HasAnyError()
+   */
+  constexpr size_t GetErrorIndex() const noexcept {
+    VOE_CONTRACT_CHECK(HasAnyError(), "GetErrorIndex() called on object with no error");
+    return Base::LogicalIndex() - Base::LogicalFirstErrorIndex();
+  }
+
+  /**
+   * @return whether this object holds an error with the specified type
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  constexpr bool HasError() const noexcept {
+    return Base::LogicalIndex() == Base::template LogicalErrorIndex<ErrorType>();
+  }
+
+  /**
+   * @return whether this object holds an error of any of the specified types
+   * @note this is a single range compare or bit test against a precomputed mask
+   */
+  template <typename... Selected>
+    requires (... && detail_::TypesContain<Selected, ErrorTypes...>)
+  constexpr bool HasAnyOf() const noexcept {
+    using Sets = ErrorIndexSets<Base, ErrorTypes...>;
+    return InIndexSet<Sets::Size, Sets::template Of<Selected...>>(Base::LogicalIndex());
+  }
+
+  /**
+   * @return whether this object holds an error of the specified category
+   * @note this is a single range compare if the category's errors are contiguous
+   *       (see Categorized), and a bit test against a precomputed mask otherwise
+   * @see ErrorCategoryTraits
+   */
+  template <typename Category>
+  constexpr bool HasErrorIn() const noexcept {
+    using Sets = ErrorIndexSets<Base, ErrorTypes...>;
+    return InIndexSet<Sets::Size, Sets::template In<Category>>(Base::LogicalIndex());
+  }
+
+  /**
+   * @return reference to underlying error of the specified type
+   * @exception UB if !HasError<ErrorType>()
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  constexpr ErrorType& GetError() & noexcept {
+    VOE_CONTRACT_CHECK(HasError<ErrorType>(), "GetError<E>() called on object with no error E");
+    return Get<Base::template PhysicalErrorIndex<ErrorType>()>(Base::Data());
+  }
+
+  /**
+   * @return rvalue reference to the underlying error object of the specified type
+   * @exception UB if !HasError<ErrorType>()
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  constexpr ErrorType&& GetError() && noexcept {
+    VOE_CONTRACT_CHECK(HasError<ErrorType>(), "GetError<E>() called on object with no error E");
+    return std::move(Get<Base::template PhysicalErrorIndex<ErrorType>()>(Base::Data()));
+  }
+
+  /**
+   * @return const reference to underlying error object of the specified type
+   * @exception UB if !HasError<ErrorType>()
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  constexpr const ErrorType& GetError() const& noexcept {
+    VOE_CONTRACT_CHECK(HasError<ErrorType>(), "GetError<E>() called on object with no error E");
+    return Get<Base::template PhysicalErrorIndex<ErrorType>()>(Base::Data());
+  }
+
+  /**
+   * @return const rvalue reference to underlying error object of the specified type
+   * @exception UB if !HasError<ErrorType>()
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  constexpr const ErrorType&& GetError() const&& noexcept {
+    VOE_CONTRACT_CHECK(HasError<ErrorType>(), "GetError<E>() called on object with no error E");
+    return std::move(Get<Base::template PhysicalErrorIndex<ErrorType>()>(Base::Data()));
+  }
+
+  /**
+   * @return reference to underlying error with type ErrorType<Index>
+   * @exception UB if !HasError<ErrorType<Index>>()
+   */
+  template <size_t Index>
+  constexpr ErrorType<Index>& GetError() & noexcept {
+    VOE_CONTRACT_CHECK(
+        HasError<ErrorType<Index>>(), "GetError<I>() called on object with no error E[I]");
+    return Get<Base::template PhysicalErrorIndex<ErrorType<Index>>()>(Base::Data());
+  }
+
+  /**
+   * @return rvalue reference to underlying error with type ErrorType<Index>
+   * @exception UB if !HasError<ErrorType<Index>>()
+   */
+  template <size_t Index>
+  constexpr ErrorType<Index>&& GetError() && noexcept {
+    VOE_CONTRACT_CHECK(
+        HasError<ErrorType<Index>>(), "GetError<I>() called on object with no error E[I]");
+    return std::move(Get<Base::template PhysicalErrorIndex<ErrorType<Index>>()>(Base::Data()));
+  }
+
+  /**
+   * @return const reference to underlying error with type ErrorType<Index>
+   * @exception UB if !HasError<ErrorType<Index>>()
+   */
+  template <size_t Index>
+  constexpr const ErrorType<Index>& GetError() const& noexcept {
+    VOE_CONTRACT_CHECK(
+        HasError<ErrorType<Index>>(), "GetError<I>() called on object with no error E[I]");
+    return Get<Base::template PhysicalErrorIndex<ErrorType<Index>>()>(Base::Data());
+  }
+
+  /**
+   * @return const rvalue reference to underlying error with type ErrorType<Index>
+   * @exception UB if !HasError<ErrorType<Index>>()
+   */
+  template <size_t Index>
+  constexpr const ErrorType<Index>&& GetError() const&& noexcept {
+    VOE_CONTRACT_CHECK(
+        HasError<ErrorType<Index>>(), "GetError<I>() called on object with no error E[I]");
+    return std::move(Get<Base::template PhysicalErrorIndex<ErrorType<Index>>()>(Base::Data()));
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct SetErrorImpl : public GetErrorImpl<ValueType, ErrorTypes...> {
+  using Base = GetErrorImpl<ValueType, ErrorTypes...>;
+
+  /**
+   * @brief Sets the error with the specified value
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  [[gnu::cold, gnu::noinline]] constexpr void SetError(ErrorType&& error) &
+    noexcept(Base::NeverEmpty)
+  {
+    Base::Clear();
+    Emplace<Base::template PhysicalErrorIndex<ErrorType>()>(
+        Base::Data(), std::forward<ErrorType>(error));
+    Base::LogicalIndex() = Base::template LogicalErrorIndex<ErrorType>();
+  }
+
+  /**
+   * @brief Sets the error by constructing it inplace via forwarding constructor arguments
+   */
+  template <typename ErrorType, typename... Args>
+  [[gnu::cold, gnu::noinline]] constexpr void EmplaceError(Args&&... args) &
+    noexcept(Base::NeverEmpty)
+  {
+    Base::Clear();
+    Emplace<Base::template PhysicalErrorIndex<ErrorType>()>(
+        Base::Data(), std::forward<Args>(args)...);
+    Base::LogicalIndex() = Base::template LogicalErrorIndex<ErrorType>();
+  }
+};
+
+template <size_t PhysicalIndex>
+struct InPlaceIndexTag {};
+
+// The library's access to the private ValueOrError constructor taking InPlaceIndexTag
+struct InPlaceFactory {
+  /**
+   * @return Result holding its PhysicalIndex-th alternative constructed from the arguments
+   */
+  template <typename Result, size_t PhysicalIndex, typename... Args>
+  static constexpr Result Make(Args&&... args) {
+    return Result(InPlaceIndexTag<PhysicalIndex>{}, std::forward<Args>(args)...);
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct ValueConstructorImpl : public SetErrorImpl<ValueType, ErrorTypes...> {
+  using Base = SetErrorImpl<ValueType, ErrorTypes...>;
+
+  /**
+   * @brief Constructs the object as holing a value using the specified value object
+   */
+  template <typename FromType>
+    requires std::same_as<ValueType, std::decay_t<FromType>>
+  constexpr void ValueConstruct(FromType&& from)
+    noexcept(std::is_nothrow_copy_constructible_v<ValueType>)
+  {
+    Emplace<0>(Base::Data(), std::forward<FromType>(from));
+    Base::LogicalIndex() = Base::LogicalValueIndex();
+  }
+
+  /**
+   * @brief Constructs the object as holding the alternative with the specified physical index
+   */
+  template <size_t PhysicalIndex, typename... Args>
+  constexpr void IndexConstruct(Args&&... args) {
+    Emplace<PhysicalIndex>(Base::Data(), std::forward<Args>(args)...);
+    Base::LogicalIndex() = Base::PhysicalToLogicalIndex(PhysicalIndex);
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct ConstructorsImpl : public ValueConstructorImpl<ValueType, ErrorTypes...> {
+  using Base = ValueConstructorImpl<ValueType, ErrorTypes...>;
+
+ protected:
+  template <typename From>
+  constexpr void Construct(From&& from) {
+    if (from.IsEmpty()) {
+      return;
+    }
+    EmplaceStorage<Base::StoredCount, Base::HotStoredCount>(
+        from.PhysicalIndex(), [](auto, auto& target, auto& stored) {
+          std::construct_at(&target, ForwardLike<From>(stored));
+        }, Base::Data(), from.Data());
+    Base::LogicalIndex() = from.LogicalIndex();
+  }
+
+  template <typename From, typename FromValueType, typename... FromErrorTypes>
+  constexpr void ConvertConstruct(
+      From&& from,
+      ConstructorsImpl<FromValueType, FromErrorTypes...>*)
+  {
+    if (from.IsEmpty()) {
+      VOE_CONTRACT_CHECK(
+          !Base::NeverEmpty, "Conversion constructor of a never empty object from an empty one");
+      return;
+    }
+    using FromType = ConstructorsImpl<FromValueType, FromErrorTypes...>;
+    using PhysicalIndexMapping =
+      typename IndexMapping<typename FromType::StoredTypes>
+      ::template MapTo<typename Base::StoredTypes>;
+
+    VisitStorage<FromType::StoredCount, FromType::HotStoredCount>(
+        from.PhysicalIndex(), [this](auto index, auto& stored) {
+          constexpr size_t this_phys_index = PhysicalIndexMapping::indices[index];
+          if constexpr (this_phys_index == size_t(-1)) {
+            VOE_CONTRACT_CHECK(
+                this_phys_index != size_t(-1),
+                "Conversion constructor from ValueOrError<X, ...> to ValueOrError<void, ...>"
+                " is trying to drop a value");
+          } else {
+            Emplace<this_phys_index>(Base::Data(), ForwardLike<From>(stored));
+            Base::LogicalIndex() = Base::PhysicalToLogicalIndex(this_phys_index);
+          }
+        }, from.Data());
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct AssignmentsImpl : public ConstructorsImpl<ValueType, ErrorTypes...> {
+  using Base = ConstructorsImpl<ValueType, ErrorTypes...>;
+
+  template <typename Assignee>
+    requires std::is_same_v<std::decay_t<Assignee>, ValueOrError<ValueType, ErrorTypes...>>
+  constexpr void Assign(Assignee&& rhs) & noexcept {
+    if (this == &rhs) {
+      return;
+    }
+    if (rhs.IsEmpty()) {
+      Base::Clear();
+      return;
+    }
+    if (Base::LogicalIndex() == rhs.LogicalIndex()) {
+      VisitStorage<Base::StoredCount, Base::HotStoredCount>(
+          Base::PhysicalIndex(), [](auto, auto& stored, auto& rhs_stored) {
+            stored = ForwardLike<Assignee>(rhs_stored);
+          }, Base::Data(), rhs.Data());
+      return;
+    }
+    Base::Clear();
+    Base::Construct(std::forward<Assignee>(rhs));
+  }
+
+  template <typename Convert, typename FromValueType, typename... FromErrorTypes>
+  constexpr void ConvertAssign(
+      Convert&& rhs,
+      ValueOrError<FromValueType, FromErrorTypes...>*) & noexcept
+  {
+    if (rhs.IsEmpty()) {
+      VOE_CONTRACT_CHECK(
+          !Base::NeverEmpty, "Conversion assignment of an empty object to a never empty one");
+      Base::Clear();
+      return;
+    }
+    using RhsType = ValueOrError<FromValueType, FromErrorTypes...>;
+    using PhysicalIndexMapping =
+        typename IndexMapping<typename RhsType::StoredTypes>
+        ::template MapTo<typename Base::StoredTypes>;
+
+    VisitStorage<RhsType::StoredCount, RhsType::HotStoredCount>(
+        rhs.PhysicalIndex(), [this](auto index, auto& rhs_stored) {
+          constexpr size_t this_phys_index = PhysicalIndexMapping::indices[index];
+          if constexpr (this_phys_index == size_t(-1)) {
+            VOE_CONTRACT_CHECK(
+                this_phys_index != size_t(-1),
+                "Conversion assignment of ValueOrError<X, ...> to ValueOrError<void, ...>"
+                " is trying to drop a value");
+          } else if (Base::PhysicalIndex() == this_phys_index) {
+            Get<this_phys_index>(Base::Data()) = ForwardLike<Convert>(rhs_stored);
+          } else {
+            Base::Clear();
+            Emplace<this_phys_index>(Base::Data(), ForwardLike<Convert>(rhs_stored));
+            Base::LogicalIndex() = Base::PhysicalToLogicalIndex(this_phys_index);
+          }
+        }, rhs.Data());
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct DiscardErrorImpl : public AssignmentsImpl<ValueType, ErrorTypes...> {
+  using Base = AssignmentsImpl<ValueType, ErrorTypes...>;
+
+  template <typename... DiscardedErrors>
+  using ResultType = TransferTemplate<
+    RemoveTypes<VariadicHolder<ErrorTypes...>, DiscardedErrors...>,
+    ValueOrError, ValueType>;
+
+  /**
+   * @brief Transforms the type by removing the specified error types
+   *
+   * In all scenarios, this object will become empty as the value or error will be moved out.
+   * - If the object was empty, the result is empty.
+   * - If the object held a value, the result holds the moved value.
+   * - If the object held an error, the result holds it in case the resulting type has this error.
+   * - If the object held an error which type is being removed, the result is empty.
+   *
+   * Never empty objects keep the moved-from value or error, and must not hold a removed error.
+   */
+  template <typename... DiscardedErrors>
+  constexpr ResultType<DiscardedErrors...> DiscardErrors() {
+    using ResultType = ResultType<DiscardedErrors...>;
+
+    if constexpr (!Base::NeverEmpty) {
+      if (Base::IsEmpty()) {
+        return ResultType{};
+      }
+    }
+
+    using PhysicalIndexMapping =
+        typename IndexMapping<typename Base::StoredTypes>
+        ::template MapTo<typename ResultType::StoredTypes>;
+
+    return VisitStorage<Base::StoredCount, Base::HotStoredCount>(
+        Base::PhysicalIndex(), [this](auto index, auto& stored) -> ResultType {
+          constexpr size_t result_phys_index = PhysicalIndexMapping::indices[index];
+          if constexpr (result_phys_index == size_t(-1)) {
+            if constexpr (Base::NeverEmpty) {
+              VOE_CONTRACT_CHECK(
+                  result_phys_index != size_t(-1),
+                  "DiscardErrors() removed the error held by a never empty object");
+              __builtin_unreachable();
+            } else {
+              return ResultType{};
+            }
+          } else {
+            ResultType result =
+              InPlaceFactory::Make<ResultType, result_phys_index>(std::move(stored));
+            if constexpr (!Base::NeverEmpty) {
+              Base::Clear();
+            }
+            return result;
+          }
+        }, Base::Data());
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct DiscardValueImpl : public DiscardErrorImpl<ValueType, ErrorTypes...> {
+  using Base = DiscardErrorImpl<ValueType, ErrorTypes...>;
+
+  /**
+   * @brief Discards the value from the type
+   * @return an object of type ValueOrError<void, ErrorTypes...> with the same state as this
+   * @exception UB: this object holds a value
+   */
+  constexpr ValueOrError<void, ErrorTypes...> DiscardValue() const& noexcept
+    requires AllCopyConstructible<ErrorTypes...>
+  {
+    VOE_CONTRACT_CHECK(!Base::HasValue(), "Discarding ValueType on object holding a value");
+    return ValueOrError<void, ErrorTypes...>(*this);
+  }
+
+  /**
+   * @brief Discards the value from the type
+   * @return an object of type ValueOrError<void, ErrorTypes...> with the error moved out of this
+   * @exception UB: this object holds a value
+   */
+  constexpr ValueOrError<void, ErrorTypes...> DiscardValue() && noexcept {
+    VOE_CONTRACT_CHECK(!Base::HasValue(), "Discarding ValueType on object holding a value");
+    return ValueOrError<void, ErrorTypes...>(std::move(*this));
+  }
+};
+
+template <typename... ErrorTypes>
+struct DiscardValueImpl<void, ErrorTypes...> : public DiscardErrorImpl<void, ErrorTypes...> {
+  using Base = DiscardErrorImpl<void, ErrorTypes...>;
+
+  /**
+   * @brief Discards the value from the type
+   * @return an object of type ValueOrError<void, ErrorTypes...> with the same state as this
+   * @note actually does nothing for VoidOrError instances
+   */
+  auto& DiscardValue() & noexcept { return *this; }
+
+  /**
+   * @brief Discards the value from the type
+   * @return an object of type ValueOrError<void, ErrorTypes...> with the same state as this
+   * @note actually does nothing for VoidOrError instances
+   */
+  const auto& DiscardValue() const& noexcept { return *this; }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct VisitImpl : public DiscardValueImpl<ValueType, ErrorTypes...> {
+  using Base = DiscardValueImpl<ValueType, ErrorTypes...>;
+
+  /**
+   * @brief Visit paradigm implementation for ValueOrError objects
+   *
+   * For non-void-value ValueOrError objects, the specified functor F will be
+   * called as follows:
+   * - F(GetValue()) if the object holds a value.
+   * - F(GetError<E>()) if the object holds an error of type E.
+   *
+   * @exception UB if the object is empty (i.e. neither holds a value nor an error)
+   */
+  template <typename Visitor>
+    requires (
+      std::invocable<Visitor, ValueType> &&
+      (... && std::invocable<Visitor, ErrorTypes>))
+  constexpr decltype(auto) Visit(Visitor&& visitor) {
+    VOE_CONTRACT_CHECK(!Base::IsEmpty(), "Visit() called on an empty object");
+    return VisitStorage<Base::StoredCount>(
+        Base::PhysicalIndex(),
+        [&visitor](auto, auto& stored) -> decltype(auto) {
+          return std::forward<Visitor>(visitor)(stored);
+        }, Base::Data());
+  }
+
+  /**
+   * @brief Visit paradigm implementation for ValueOrError objects
+   * @see Visit, this is a const version of it
+   */
+  template <typename Visitor>
+    requires (
+      std::invocable<Visitor, const ValueType> &&
+      (... && std::invocable<Visitor, const ErrorTypes>))
+  constexpr decltype(auto) Visit(Visitor&& visitor) const {
+    VOE_CONTRACT_CHECK(!Base::IsEmpty(), "Visit() called on an empty object");
+    return VisitStorage<Base::StoredCount>(
+        Base::PhysicalIndex(),
+        [&visitor](auto, auto& stored) -> decltype(auto) {
+          return std::forward<Visitor>(visitor)(stored);
+        }, Base::Data());
+  }
+};
+
+template <typename... ErrorTypes>
+struct VisitImpl<void, ErrorTypes...> : public DiscardValueImpl<void, ErrorTypes...> {
+  using Base = DiscardValueImpl<void, ErrorTypes...>;
+
+  /**
+   * @brief Visit paradigm implementation for ValueOrError objects
+   *
+   * For void-value ValueOrError objects, the specified functor F will be called as follows:
+   * - F() if the object is empty (holds a void value).
+   * - F(GetError<E>()) if the object holds an error of type E.
+   */
+  template <typename Visitor>
+    requires (
+      std::invocable<Visitor> &&
+      (... && std::invocable<Visitor, ErrorTypes>))
+  constexpr decltype(auto) Visit(Visitor&& visitor) {
+    if constexpr (sizeof...(ErrorTypes) > 0) {
+      if (Base::HasAnyError()) {
+        return VisitStorage<Base::StoredCount>(
+            Base::PhysicalIndex(),
+            [&visitor](auto, auto& stored) -> decltype(auto) {
+              return std::forward<Visitor>(visitor)(stored);
+            }, Base::Data());
+      }
+    }
+    return std::forward<Visitor>(visitor)();
+  }
+
+  /**
+   * @brief Visit paradigm implementation for ValueOrError objects
+   * @see Visit, this is a const version of it
+   */
+  template <typename Visitor>
+    requires (
+      std::invocable<Visitor> &&
+      (... && std::invocable<Visitor, const ErrorTypes>))
+  constexpr decltype(auto) Visit(Visitor&& visitor) const {
+    if constexpr (sizeof...(ErrorTypes) > 0) {
+      if (Base::HasAnyError()) {
+        return VisitStorage<Base::StoredCount>(
+            Base::PhysicalIndex(),
+            [&visitor](auto, auto& stored) -> decltype(auto) {
+              return std::forward<Visitor>(visitor)(stored);
+            }, Base::Data());
+      }
+    }
+    return std::forward<Visitor>(visitor)();
+  }
+};
+
+struct UncheckedConvertTag {};
+
+template <typename Result, typename From>
+Result FlattenInto(From&& from) {
+  using FromValueType = typename std::remove_cvref_t<From>::value_type;
+  if constexpr (IsValueOrError<FromValueType>) {
+    if (from.HasValue()) {
+      return FlattenInto<Result>(std::forward<From>(from).GetValue());
+    }
+  }
+  return Result(UncheckedConvertTag{}, std::forward<From>(from));
+}
+
+template <typename Callable, typename Self, typename ValueType>
+struct ValueInvokeResultHolder {
+  using type = std::invoke_result_t<Callable, decltype(std::declval<Self>().GetValue())>;
+};
+
+template <typename Callable, typename Self>
+struct ValueInvokeResultHolder<Callable, Self, void> {
+  using type = std::invoke_result_t<Callable>;
+};
+
+template <typename Callable, typename Self, typename ValueType>
+using ValueInvokeResult =
+  std::remove_cvref_t<typename ValueInvokeResultHolder<Callable, Self, ValueType>::type>;
+
+template <typename Callable, typename Self, typename ErrorType>
+using ErrorInvokeResult = std::remove_cvref_t<
+  std::invoke_result_t<
+    Callable,
+    decltype(ForwardLike<Self>(std::declval<PropagateConst<Self, ErrorType>&>()))>>;
+
+template <typename T>
+struct UnwrapTypeIdentityHolder { using type = T; };
+
+template <typename T>
+struct UnwrapTypeIdentityHolder<std::type_identity<T>> { using type = T; };
+
+// Error is the stored error type with the value category MapErrors forwards it with (e.g.
+// const E& for the copying version), so that the same Translate() overload is probed and called
+template <typename Translator, typename Error>
+struct TranslatedErrorHolder {
+  static constexpr bool IsIdentity = true;
+  using type = std::remove_cvref_t<Error>;
+};
+
+template <typename Translator, typename Error>
+  requires requires { Translator::Translate(std::declval<Error>()); }
+struct TranslatedErrorHolder<Translator, Error> {
+  using Translated = std::remove_cvref_t<decltype(Translator::Translate(std::declval<Error>()))>;
+
+  static constexpr bool IsIdentity = false;
+  using type = typename UnwrapTypeIdentityHolder<Translated>::type;
+};
+
+template <typename Translator, typename Error>
+using TranslatedError = typename TranslatedErrorHolder<Translator, Error>::type;
+
+template <typename Result, typename Translator>
+struct TranslateErrorFunctor {
+  template <typename NewErrorType, typename... Args>
+  static constexpr Result Make(Args&&... args) {
+    return InPlaceFactory::Make<Result, Result::template PhysicalErrorIndex<NewErrorType>()>(
+        std::forward<Args>(args)...);
+  }
+
+  template <typename Error>
+  static constexpr Result Call(Error&& error) {
+    using Holder = TranslatedErrorHolder<Translator, Error&&>;
+    if constexpr (Holder::IsIdentity) {
+      return Make<std::remove_cvref_t<Error>>(std::forward<Error>(error));
+    } else if constexpr (std::is_same_v<typename Holder::Translated, typename Holder::type>) {
+      return Make<typename Holder::type>(Translator::Translate(std::forward<Error>(error)));
+    } else {
+      return Make<typename Holder::type>(std::forward<Error>(error));
+    }
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+struct MonadicImpl : public VisitImpl<ValueType, ErrorTypes...> {
+  using Base = VisitImpl<ValueType, ErrorTypes...>;
+  using SelfType = ValueOrError<ValueType, ErrorTypes...>;
+
+  /**
+   * @brief Applies the callable to the held value
+   *
+   * - If the object holds a value (is empty for void ValueType), the result holds F(GetValue())
+   *   (is F() for void ValueType). The result is empty if F returns void;
+   * - Otherwise, the result holds the same error (is empty) as this object.
+   *
+   * The value and the error are moved out of this object.
+   *
+   * @return an object of type Flat<ValueOrError<decay(F(ValueType)), ErrorTypes...>>
+   * @note if F returns a ValueOrError, the result is flattened (see Flatten)
+   */
+  template <typename Callable>
+  constexpr auto Transform(Callable&& callable) && {
+    return TransformImpl(std::move(Self()), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the callable to the held value
+   * @see Transform, this is a copying version of it
+   */
+  template <typename Callable>
+  constexpr auto Transform(Callable&& callable) const& {
+    return TransformImpl(Self(), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the ValueOrError-returning callable to the held value
+   *
+   * - If the object holds a value (is empty for void ValueType), the result holds the same
+   *   value or error as F(GetValue()) (is F() for void ValueType);
+   * - Otherwise, the result holds the same error (is empty) as this object.
+   *
+   * The value and the error are moved out of this object.
+   *
+   * @return an object of type Flat<voe::Union<R::value_type, ValueOrError, R>>,
+   *         where R = F(ValueType)
+   */
+  template <typename Callable>
+  constexpr auto AndThen(Callable&& callable) && {
+    return AndThenImpl(std::move(Self()), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the ValueOrError-returning callable to the held value
+   * @see AndThen, this is a copying version of it
+   */
+  template <typename Callable>
+  constexpr auto AndThen(Callable&& callable) const& {
+    return AndThenImpl(Self(), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the ValueOrError-returning callable to the held error
+   *
+   * The callable has to accept each of ErrorTypes... and to return ValueOrError<ValueType, ...>
+   * or ValueOrError<void, ...>.
+   * - If the object holds an error, the result holds the same value or error as F(GetError<E>());
+   * - Otherwise, the result holds the same value (is empty) as this object.
+   *
+   * The value and the error are moved out of this object.
+   *
+   * @return an object of type voe::Union<ValueType, R<ErrorTypes>...>, where R<E> = F(E)
+   */
+  template <typename Callable>
+  constexpr auto OrElse(Callable&& callable) && {
+    return OrElseImpl(std::move(Self()), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the ValueOrError-returning callable to the held error
+   * @see OrElse, this is a copying version of it
+   */
+  template <typename Callable>
+  constexpr auto OrElse(Callable&& callable) const& {
+    return OrElseImpl(Self(), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the callable to the held error
+   *
+   * The callable has to accept each of ErrorTypes... and to return a new error object.
+   * - If the object holds an error, the result holds the error F(GetError<E>());
+   * - Otherwise, the result holds the same value (is empty) as this object.
+   *
+   * The value and the error are moved out of this object.
+   *
+   * @return an object of type voe::Union<ValueType, decay(F(ErrorTypes))...>
+   */
+  template <typename Callable>
+  constexpr auto TransformError(Callable&& callable) && {
+    return TransformErrorImpl(std::move(Self()), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Applies the callable to the held error
+   * @see TransformError, this is a copying version of it
+   */
+  template <typename Callable>
+  constexpr auto TransformError(Callable&& callable) const& {
+    return TransformErrorImpl(Self(), std::forward<Callable>(callable));
+  }
+
+  /**
+   * @brief Translates the held error using the compile-time translation table
+   *
+   * Translator is a class with static Translate() overloads, probed and called with the errors
+   * forwarded as E&& (and as const E& by the copying version). For each of ErrorTypes... E:
+   * - If Translator::Translate(E) returns std::type_identity<T>, the error is converted to T
+   *   by constructing T from E (Translate() is never called and may be left undefined);
+   * - Otherwise, if Translator::Translate(E) is well-formed, the error is replaced with
+   *   its result;
+   * - Otherwise, the error is left as is.
+   *
+   * The translation is a single dispatch over PhysicalIndex(). If the object holds a value
+   * (is empty), the result holds the same value (is empty).
+   *
+   * The value and the error are moved out of this object.
+   *
+   * @return an object of type voe::Union<ValueType, T(ErrorTypes)...>, where T(E) is the
+   *         type E is translated to
+   */
+  template <typename Translator>
+  constexpr auto MapErrors() && {
+    return MapErrorsImpl<Translator>(std::move(Self()));
+  }
+
+  /**
+   * @brief Translates the held error using the compile-time translation table
+   * @see MapErrors, this is a copying version of it
+   */
+  template <typename Translator>
+  constexpr auto MapErrors() const& {
+    return MapErrorsImpl<Translator>(Self());
+  }
+
+  /**
+   * @brief Removes nesting of ValueOrError types
+   *
+   * The object of type ValueOrError<ValueOrError<T, E1...>, E2...> is transformed to an object
+   * of type Flat<ValueOrError<ValueOrError<T, E1...>, E2...>> = voe::Union<T, E1..., E2...>
+   * (applied recursively for deeper nesting), which holds:
+   * - the innermost value or error, if the object holds a value;
+   * - the same error as this object, if the object holds an error.
+   *
+   * The innermost value or the error is moved out of this object directly to the result.
+   * For ValueOrError types with non-ValueOrError ValueType this is a move.
+   */
+  constexpr Flat<SelfType> Flatten() && {
+    return FlattenInto<Flat<SelfType>>(std::move(Self()));
+  }
+
+  /**
+   * @brief Removes nesting of ValueOrError types
+   * @see Flatten, this is a copying version of it
+   */
+  constexpr Flat<SelfType> Flatten() const&
+    requires AllCopyConstructible<ValueType, ErrorTypes...>
+  {
+    return FlattenInto<Flat<SelfType>>(Self());
+  }
+
+ private:
+  constexpr SelfType& Self() noexcept { return static_cast<SelfType&>(*this); }
+  constexpr const SelfType& Self() const noexcept { return static_cast<const SelfType&>(*this); }
+
+  static constexpr bool Succeeded(const SelfType& self) noexcept {
+    if constexpr (std::is_same_v<void, ValueType>) {
+      return !self.HasAnyError();
+    } else {
+      return self.HasValue();
+    }
+  }
+
+  template <typename Self, typename Callable>
+  static constexpr decltype(auto) InvokeOnValue(Self&& self, Callable&& callable) {
+    if constexpr (std::is_same_v<void, ValueType>) {
+      return std::invoke(std::forward<Callable>(callable));
+    } else {
+      return std::invoke(std::forward<Callable>(callable), std::forward<Self>(self).GetValue());
+    }
+  }
+
+  template <typename Result, typename Self, typename Callable>
+  static constexpr Result VisitErrors(Self&& self, Callable&& callable) {
+    auto visitor = [&callable](auto& error) -> Result {
+      using Type = std::remove_cvref_t<decltype(error)>;
+      if constexpr (TypesContain<Type, ErrorTypes...>) {
+        return std::invoke(std::forward<Callable>(callable), ForwardLike<Self>(error));
+      } else {
+        VOE_CONTRACT_CHECK(false, "VisitErrors() called on object with no error");
+        __builtin_unreachable();
+      }
+    };
+    return VisitStorage<Base::StoredCount, 0>(
+        self.PhysicalIndex(), [&visitor](auto, auto& stored) -> Result {
+          return visitor(stored);
+        }, self.Data());
+  }
+
+  template <typename Self, typename Callable>
+  static constexpr auto TransformImpl(Self&& self, Callable&& callable) {
+    using NewValueType = ValueInvokeResult<Callable, Self, ValueType>;
+    using Result = Flat<ValueOrError<NewValueType, ErrorTypes...>>;
+
+    if (!Succeeded(self)) {
+      return Result(UncheckedConvertTag{}, std::forward<Self>(self));
+    }
+    if constexpr (std::is_same_v<void, NewValueType>) {
+      InvokeOnValue(std::forward<Self>(self), std::forward<Callable>(callable));
+      return Result{};
+    } else if constexpr (IsValueOrError<NewValueType>) {
+      return FlattenInto<Result>(
+          InvokeOnValue(std::forward<Self>(self), std::forward<Callable>(callable)));
+    } else {
+      return Result(InvokeOnValue(std::forward<Self>(self), std::forward<Callable>(callable)));
+    }
+  }
+
+  template <typename Self, typename Callable>
+  static constexpr auto AndThenImpl(Self&& self, Callable&& callable) {
+    using CallableResult = ValueInvokeResult<Callable, Self, ValueType>;
+    static_assert(IsValueOrError<CallableResult>, "AndThen() callable must return ValueOrError");
+    using Result = Flat<UnionValueOrError<
+      typename CallableResult::value_type, SelfType, CallableResult>>;
+
+    if (!Succeeded(self)) {
+      return Result(UncheckedConvertTag{}, std::forward<Self>(self));
+    }
+    return FlattenInto<Result>(
+        InvokeOnValue(std::forward<Self>(self), std::forward<Callable>(callable)));
+  }
+
+  template <typename Self, typename Callable>
+  static constexpr auto OrElseImpl(Self&& self, Callable&& callable) {
+    static_assert(
+        (... && IsValueOrError<ErrorInvokeResult<Callable, Self, ErrorTypes>>),
+        "OrElse() callable must return ValueOrError");
+    static_assert(
+        (... || !IsValueOrError<ErrorInvokeResult<Callable, Self, ErrorTypes>>)
+          || (... && (IsValueOrErrorOf<ErrorInvokeResult<Callable, Self, ErrorTypes>, ValueType>
+                      || IsValueOrErrorOf<ErrorInvokeResult<Callable, Self, ErrorTypes>, void>)),
+        "OrElse() callable must return ValueOrError with the same ValueType, or VoidOrError");
+    using Result = UnionValueOrError<ValueType, ErrorInvokeResult<Callable, Self, ErrorTypes>...>;
+
+    if constexpr (sizeof...(ErrorTypes) == 0) {
+      return Result(UncheckedConvertTag{}, std::forward<Self>(self));
+    } else {
+      if (!self.HasAnyError()) {
+        return Result(UncheckedConvertTag{}, std::forward<Self>(self));
+      }
+      return VisitErrors<Result>(
+          std::forward<Self>(self),
+          [&callable](auto&& error) {
+            return Result(UncheckedConvertTag{}, std::invoke(
+                std::forward<Callable>(callable), std::forward<decltype(error)>(error)));
+          });
+    }
+  }
+
+  template <typename Self, typename Callable>
+  static constexpr auto TransformErrorImpl(Self&& self, Callable&& callable) {
+    using Result = UnionValueOrError<ValueType, ErrorInvokeResult<Callable, Self, ErrorTypes>...>;
+
+    if constexpr (sizeof...(ErrorTypes) == 0) {
+      return Result(UncheckedConvertTag{}, std::forward<Self>(self));
+    } else {
+      if (!self.HasAnyError()) {
+        return Result(UncheckedConvertTag{}, std::forward<Self>(self));
+      }
+      return VisitErrors<Result>(
+          std::forward<Self>(self),
+          [&callable](auto&& error) {
+            using NewErrorType = std::remove_cvref_t<decltype(std::invoke(
+                std::forward<Callable>(callable), std::forward<decltype(error)>(error)))>;
+            return InPlaceFactory::Make<
+              Result, Result::template PhysicalErrorIndex<NewErrorType>()>(std::invoke(
+                std::forward<Callable>(callable), std::forward<decltype(error)>(error)));
+          });
+    }
+  }
+
+  template <typename Translator, typename Self>
+  static constexpr auto MapErrorsImpl(Self&& self) {
+    using Result = UnionValueOrError<
+      ValueType, TranslatedError<Translator, ForwardLikeType<Self, ErrorTypes>>...>;
+
+    if constexpr (std::is_same_v<Result, SelfType> &&
+                  (... && TranslatedErrorHolder<
+                            Translator, ForwardLikeType<Self, ErrorTypes>>::IsIdentity)) {
+      return Result(std::forward<Self>(self));
+    } else {
+      if constexpr (!Base::NeverEmpty) {
+        if (self.IsEmpty()) {
+          return Result{};
+        }
+      }
+      return VisitStorage<Base::StoredCount>(self.PhysicalIndex(), [](auto index, auto& data) {
+        auto&& stored = ForwardLike<Self>(data);
+        if constexpr (!std::is_same_v<void, ValueType> && index == 0) {
+          return Result(std::forward<decltype(stored)>(stored));
+        } else {
+          return TranslateErrorFunctor<Result, Translator>::Call(
+              std::forward<decltype(stored)>(stored));
+        }
+      }, self.Data());
+    }
+  }
+};
+
+template <typename ValueType, typename... ErrorTypes>
+using ValueOrErrorImpl = MonadicImpl<ValueType, ErrorTypes...>;
+
+}  // namespace detail_
+
+/**
+ * @brief A class representing either value or some error.
+ *
+ * The object of this class can be in 2 or 3 states, depending on ValueType template parameter:
+ * - Empty;
+ * - Has value: iff !std::is_same_v<void, ValueType>;
+ * - Has error: iff sizeof...(ErrorTypes) > 0.
+ *
+ * The object can be created as empty or having value. In order to create an object holding an
+ * error, one should use voe::MakeError.
+ *
+ * The copy and move operations are constrained on the alternatives, e.g.
+ * std::is_copy_constructible_v is false if one of the alternatives is move-only (rather than
+ * true with a hard error on use). This is what lets VOE_EXTERN_TEMPLATE instantiate all the
+ * members of the class for move-only alternatives.
+ *
+ * @exception None (the object does not produce any exceptions)
+ */
+template <typename ValueType, typename... ErrorTypes>
+class [[nodiscard]] ValueOrError
+  : public detail_::ValueOrErrorImpl<ValueType, ErrorTypes...>
+{
+  using Base = detail_::ValueOrErrorImpl<ValueType, ErrorTypes...>;
+  using SelfType = ValueOrError<ValueType, ErrorTypes...>;
+
+ public:
+  using value_type = ValueType;
+  static_assert(detail_::AllDecayed<ValueType, ErrorTypes...>, "All types must be decayed");
+  static_assert(detail_::AllUnique<ErrorTypes...>, "Error types must not contain duplicates");
+
+  /**
+   * @brief Constructs an empty ValueOrError
+   *
+   * An empty ValueOrError neither holds error nor value.
+   * Calls to such methods as GetError or GetValue will result in UB.
+   * HasAnyError, HasError<*>, HasValue will return false;
+   *
+   * @note not available for never empty types, see NeverEmptyTraits
+   */
+  constexpr ValueOrError() noexcept requires (!Base::NeverEmpty) = default;
+
+  /**
+   * @brief Construct a ValueOrError holding a value
+   *
+   * The resulting object will store the value. HasValue will return true and
+   * GetValue will be legal to use.
+   *
+   * @param from the value to be constructed from
+   * @exception only ones thrown by ValueType's related copy/move constructor
+   */
+  template <typename FromType>
+    requires std::same_as<ValueType, std::decay_t<FromType>>
+  constexpr /* implicit */ ValueOrError(FromType&& from)
+    noexcept(std::is_nothrow_copy_constructible_v<ValueType>)
+  { Base::ValueConstruct(std::forward<FromType>(from)); }
+
+  constexpr ValueOrError(ValueOrError& voe)
+    requires detail_::ConstructibleLike<ValueOrError&, ValueType, ErrorTypes...>
+  { Base::Construct(voe); }
+  constexpr ValueOrError(const ValueOrError& voe)
+    requires detail_::ConstructibleLike<const ValueOrError&, ValueType, ErrorTypes...>
+  { Base::Construct(voe); }
+  constexpr ValueOrError(ValueOrError&& voe)
+    requires detail_::ConstructibleLike<ValueOrError&&, ValueType, ErrorTypes...>
+  { Base::Construct(std::move(voe)); }
+  constexpr ValueOrError(const ValueOrError&& voe)
+    requires detail_::ConstructibleLike<const ValueOrError&&, ValueType, ErrorTypes...>
+  { Base::Construct(std::move(voe)); }
+
+  /**
+   * @brief ValueOrError conversion constructor
+   *
+   * The ValueOrError template instances are considered convertible iff:
+   * - Their respective ValueType parameters are either same or void (one or both);
+   * - The ErrorTypes... of from ValueOrError must be a subset of ErrorTypes... of to one.
+   *
+   * The rules are as follows:
+   * - If from is empty, then the resulting object will be empty;
+   * - If from holds a value (thus its ValueType is not void), and this type's ValueType is
+   *   also not equal to void, than the value will be copied/moved to the resulting object;
+   * - If from holds an error, than this error will be copied/moved to the resulting object.
+   *
+   * @exception (UB) from holds a value, and this type's ValueType is void
+   * @exception Any exception thrown from copy or move constructor of respective type
+   */
+  template <typename FromVoe>
+    requires detail_::Convertible<
+        detail_::TransferTemplate<std::decay_t<FromVoe>, detail_::VariadicHolder>,
+        detail_::VariadicHolder<ValueType, ErrorTypes...>
+    > && detail_::AlternativesConstructibleLike<FromVoe&&, ValueType>
+  constexpr /* implicit */ ValueOrError(FromVoe&& from) {
+    Base::ConvertConstruct(
+        std::forward<FromVoe>(from), static_cast<std::decay_t<FromVoe>*>(nullptr));
+  }
+
+  /**
+   * @brief ValueOrError unchecked conversion constructor
+   *
+   * Constructs the object holding the same value or error as from. Unlike the conversion
+   * constructor, ValueType of from is not required to be the same as this type's ValueType.
+   * It is used to propagate errors between ValueOrError types with different value types.
+   *
+   * @exception (UB) from holds a value or an error that this type can not hold
+   */
+  template <typename FromVoe>
+    requires detail_::IsValueOrError<FromVoe>
+  constexpr ValueOrError(detail_::UncheckedConvertTag, FromVoe&& from) {
+    Base::ConvertConstruct(
+        std::forward<FromVoe>(from), static_cast<std::decay_t<FromVoe>*>(nullptr));
+  }
+
+  constexpr SelfType& operator=(ValueOrError& arg) &
+    requires detail_::AssignableLike<ValueOrError&, ValueType, ErrorTypes...>
+  { Base::Assign(arg); return *this; }
+  constexpr SelfType& operator=(const ValueOrError& arg) &
+    requires detail_::AssignableLike<const ValueOrError&, ValueType, ErrorTypes...>
+  { Base::Assign(arg); return *this; }
+  constexpr SelfType& operator=(ValueOrError&& arg) &
+    requires detail_::AssignableLike<ValueOrError&&, ValueType, ErrorTypes...>
+  { Base::Assign(std::move(arg)); return *this; }
+  constexpr SelfType& operator=(const ValueOrError&& arg) &
+    requires detail_::AssignableLike<const ValueOrError&&, ValueType, ErrorTypes...>
+  { Base::Assign(std::move(arg)); return *this; }
+
+  /**
+   * @brief ValueOrError conversion assignment operator
+   *
+   * See the conversion constructor operator in order to review the definition
+   * of convertible ValueOrError template instances. The resulting object
+   * will have the same properties as described in conversion constructor.
+   *
+   * The difference to conversion constructor is that if this object holds a value or an error,
+   * it has to be either destroyed before construction of a new value or assigned to a new object,
+   * depending on equality of types of objects that are held by lhs and rhs.
+   *
+   * @exception (UB) rhs holds a value, and this type's ValueType is void
+   * @exception Any exception thrown from copy or move constructor of respective type
+   */
+  template <typename FromVoe>
+    requires detail_::Convertible<
+        detail_::TransferTemplate<std::decay_t<FromVoe>, detail_::VariadicHolder>,
+        detail_::VariadicHolder<ValueType, ErrorTypes...>
+    > && detail_::AlternativesAssignableLike<FromVoe&&, ValueType>
+  constexpr SelfType& operator=(FromVoe&& rhs) & {
+    Base::ConvertAssign(std::forward<FromVoe>(rhs), static_cast<std::decay_t<FromVoe>*>(nullptr));
+    return *this;
+  }
+
+  /**
+   * @brief Clears the object. The state after method is applied is Empty.
+   * @note not available for never empty types, see NeverEmptyTraits
+   */
+  constexpr void Clear() noexcept requires (!Base::NeverEmpty) { Base::Clear(); }
+
+ protected:
+  template <typename, typename...>
+  friend class ValueOrError;
+
+ private:
+  friend struct detail_::InPlaceFactory;
+
+  /**
+   * @brief Constructs the object holding the alternative with the specified physical index
+   *
+   * It is used to create objects holding an error without creating an empty object first.
+   * Physical indices are an implementation detail, so it is only available to the library
+   * through detail_::InPlaceFactory.
+   */
+  template <size_t PhysicalIndex, typename... Args>
+  constexpr ValueOrError(detail_::InPlaceIndexTag<PhysicalIndex>, Args&&... args) {
+    Base::template IndexConstruct<PhysicalIndex>(std::forward<Args>(args)...);
+  }
+};
+
+/**
+ * @brief A shorter type template alias for void-returning functions
+ */
+template <typename... ErrorTypes>
+using VoidOrError = ValueOrError<void, ErrorTypes...>;
+
+/**
+ * @brief A convernient and explicit way to create error objects
+ * @param[in] ErrorType the type of an error
+ * @param[in] error instance of #ErrorType&&
+ * @return an instance of #ValueOrError<void, ErrorType> holding an error
+ */
+template <typename ErrorType>
+constexpr VoidOrError<ErrorType> MakeError(ErrorType&& error) {
+  VoidOrError<ErrorType> result;
+  result.SetError(std::forward<ErrorType>(error));
+  return result;
+}
+
+/**
+ * @brief A convernient and explicit way to create error objects
+ * @param[in] ErrorType the type of an error
+ * @param[in] Args types of #ErrorType constructor arguments
+ * @param[in] args #ErrorType constructor arguments
+ * @return an instance of #ValueOrError<void, ErrorType> holding an error
+ */
+template <typename ErrorType, typename... Args>
+constexpr VoidOrError<ErrorType> MakeError(Args&&... args) {
+  VoidOrError<ErrorType> result;
+  result.template EmplaceError<ErrorType>(std::forward<Args>(args)...);
+  return result;
+}
+
+/**
+ * @brief Combine two ValueOrError types
+ *
+ * For example, consider the following snippet:
+ * @code
+ * using A = ValueOrError<char, int, short>;
+ * A Foo() { ... }
+ *
+ * using B = ValueOrError<void, long, int>;
+ * B Bar() { ... }
+ *
+ * using C = Union<float, A, B>;
+ * static_assert(std::is_same_v<C, ValueOrError<float, int, short, long>>);
+ *
+ * C Baz() {
+ *   RETURN_IF_ERROR(Foo());
+ *   RETURN_IF_ERROR(Bar());
+ *   return 10.f;
+ * }
+ * @endcode
+ */
+template <typename ValueType, typename... VoEOrErrorTypes>
+using Union = detail_::UnionValueOrError<ValueType, VoEOrErrorTypes...>;
+
+/**
+ * @brief Removes nesting of ValueOrError types
+ *
+ * For example, consider the following snippet:
+ * @code
+ * using A = ValueOrError<ValueOrError<ValueOrError<int, char>, short>, char, long>;
+ * static_assert(std::is_same_v<Flat<A>, ValueOrError<int, short, char, long>>);
+ * @endcode
+ *
+ * @see ValueOrError::Flatten
+ */
+template <typename T>
+using Flat = detail_::Flat<T>;
+
+}  // namespace voe
+
+#undef VOE_IS_SAME
+#undef VOE_HAS_TYPE_PACK_ELEMENT
+
+#endif  // VOE_CORE_HEADER
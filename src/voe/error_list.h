@@ -0,0 +1,259 @@
+#ifndef VOE_ERROR_LIST_HEADER
+#define VOE_ERROR_LIST_HEADER
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "voe/core.h"
+
+namespace voe {
+
+/**
+ * @brief A list of errors, accumulated by the checks reporting all of their failures
+ *
+ * Each of the errors is stored as VoidOrError<ErrorTypes...>, i.e. only its discriminant and
+ * payload. The first kInlineCapacity errors are stored inline, and the rest spill to the heap,
+ * so a list of up to kInlineCapacity errors never allocates.
+ *
+ * The list is usually returned as the error of ValueOrError<ValueType, ErrorList<...>>, see
+ * IntoResult, CollectErrors and CheckAll.
+ */
+template <typename... ErrorTypes>
+class ErrorList {
+ public:
+  using value_type = VoidOrError<ErrorTypes...>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_t kInlineCapacity = 2;
+
+  /**
+   * @brief A random access iterator over the errors
+   */
+  class Iterator {
+   public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = VoidOrError<ErrorTypes...>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    Iterator() noexcept = default;
+
+    const value_type& operator*() const noexcept { return (*list_)[index_]; }
+    const value_type* operator->() const noexcept { return &(*list_)[index_]; }
+    const value_type& operator[](difference_type offset) const noexcept {
+      return (*list_)[index_ + offset];
+    }
+
+    Iterator& operator++() noexcept { ++index_; return *this; }
+    Iterator operator++(int) noexcept { Iterator copy = *this; ++index_; return copy; }
+    Iterator& operator--() noexcept { --index_; return *this; }
+    Iterator operator--(int) noexcept { Iterator copy = *this; --index_; return copy; }
+
+    Iterator& operator+=(difference_type offset) noexcept { index_ += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { index_ -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return static_cast<difference_type>(lhs.index_ - rhs.index_);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.index_ == rhs.index_;
+    }
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.index_ <=> rhs.index_;
+    }
+
+   private:
+    friend class ErrorList;
+
+    Iterator(const ErrorList* list, size_t index) noexcept
+      : list_(list)
+      , index_(index)
+    {}
+
+    const ErrorList* list_{nullptr};
+    size_t index_{0};
+  };
+
+  ErrorList() = default;
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  /**
+   * @return the error at the specified position, in the order the errors were added
+   * @exception UB if index >= size()
+   */
+  const value_type& operator[](size_t index) const noexcept {
+    VOE_CONTRACT_CHECK(index < size_, "ErrorList index is out of range");
+    return index < kInlineCapacity ? inline_[index] : spilled_[index - kInlineCapacity];
+  }
+
+  Iterator begin() const noexcept { return Iterator(this, 0); }
+  Iterator end() const noexcept { return Iterator(this, size_); }
+
+  void clear() noexcept {
+    for (size_t index = 0; index < std::min(size_, kInlineCapacity); ++index) {
+      inline_[index].Clear();
+    }
+    spilled_.clear();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Appends the error of the specified type, constructed from the arguments
+   */
+  template <typename ErrorType, typename... Args>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  void EmplaceError(Args&&... args) {
+    if (size_ < kInlineCapacity) {
+      inline_[size_].template EmplaceError<ErrorType>(std::forward<Args>(args)...);
+    } else {
+      spilled_.push_back(
+          detail_::InPlaceFactory::Make<
+            value_type, value_type::template PhysicalErrorIndex<ErrorType>()>(
+              std::forward<Args>(args)...));
+    }
+    ++size_;
+  }
+
+  /**
+   * @brief Appends the error held by the result, if any
+   *
+   * The values and the empty objects are ignored, so the statuses of the checks can be added
+   * as they are.
+   *
+   * @return whether the result held an error
+   */
+  template <typename Result>
+    requires detail_::IsValueOrError<Result>
+          && detail_::SubsetOf<
+               detail_::ErrorTypes<std::remove_cvref_t<Result>>,
+               detail_::VariadicHolder<ErrorTypes...>>::value
+  bool Add(Result&& result) {
+    if (!result.HasAnyError()) {
+      return false;
+    }
+    if (size_ < kInlineCapacity) {
+      inline_[size_] = value_type(detail_::UncheckedConvertTag{}, std::forward<Result>(result));
+    } else {
+      spilled_.emplace_back(detail_::UncheckedConvertTag{}, std::forward<Result>(result));
+    }
+    ++size_;
+    return true;
+  }
+
+  /**
+   * @return whether the list contains an error of the specified type
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  bool HasError() const noexcept {
+    for (const value_type& error : *this) {
+      if (error.template HasError<ErrorType>()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @return a success if the list is empty, and the list as the error otherwise
+   */
+  VoidOrError<ErrorList> IntoResult() && {
+    if (empty()) {
+      return {};
+    }
+    return MakeError<ErrorList>(std::move(*this));
+  }
+
+  /**
+   * @return the value if the list is empty, and the list as the error otherwise
+   */
+  template <typename ValueType>
+  ValueOrError<std::decay_t<ValueType>, ErrorList> IntoResult(ValueType&& value) && {
+    using Result = ValueOrError<std::decay_t<ValueType>, ErrorList>;
+    if (empty()) {
+      return Result(std::forward<ValueType>(value));
+    }
+    return detail_::InPlaceFactory::Make<Result, Result::template PhysicalErrorIndex<ErrorList>()>(
+        std::move(*this));
+  }
+
+ private:
+  std::array<value_type, kInlineCapacity> inline_{};
+  std::vector<value_type> spilled_;
+  size_t size_{0};
+};
+
+namespace detail_ {
+
+template <typename... Results>
+using CollectedErrorList = TransferTemplate<
+  Union<ErrorTypes<std::remove_cvref_t<Results>>...>, ErrorList>;
+
+}  // namespace detail_
+
+/**
+ * @brief Accumulates the errors of the results into a list, in the order of the arguments
+ *
+ * The list holds the union of the error types of the results. The values and the empty objects
+ * are ignored.
+ *
+ * @code
+ * auto errors = CollectErrors(CheckName(user), CheckEmail(user), CheckAge(user));
+ * @endcode
+ *
+ * @note the arguments are evaluated in an unspecified order, use CheckAll if the checks must
+ *       run in order
+ */
+template <typename... Results>
+  requires (... && detail_::IsValueOrError<Results>)
+detail_::CollectedErrorList<Results...> CollectErrors(Results&&... results) {
+  detail_::CollectedErrorList<Results...> errors;
+  (errors.Add(std::forward<Results>(results)), ...);
+  return errors;
+}
+
+/**
+ * @brief Runs all of the checks against the value, and returns either the value or all of
+ * their errors
+ *
+ * Each check is invoked in order with a const reference to the value, and returns a ValueOrError
+ * (usually a VoidOrError) whose errors are accumulated into the list. The value is moved to the
+ * result only if none of the checks failed.
+ *
+ * @code
+ * ValueOrError<User, ErrorList<BadName, BadEmail>> Validate(User user) {
+ *   return CheckAll(std::move(user), CheckName, CheckEmail);
+ * }
+ * @endcode
+ */
+template <typename ValueType, typename... Checks>
+  requires (... && detail_::IsValueOrError<
+               std::invoke_result_t<Checks&, const std::decay_t<ValueType>&>>)
+ValueOrError<
+  std::decay_t<ValueType>,
+  detail_::CollectedErrorList<std::invoke_result_t<Checks&, const std::decay_t<ValueType>&>...>>
+CheckAll(ValueType&& value, Checks&&... checks) {
+  const std::decay_t<ValueType>& checked = value;
+  detail_::CollectedErrorList<
+    std::invoke_result_t<Checks&, const std::decay_t<ValueType>&>...> errors;
+  (errors.Add(std::invoke(checks, checked)), ...);
+  return std::move(errors).IntoResult(std::forward<ValueType>(value));
+}
+
+}  // namespace voe
+
+#endif  // VOE_ERROR_LIST_HEADER
@@ -0,0 +1,66 @@
+#ifndef VOE_INSTANTIATE_HEADER
+#define VOE_INSTANTIATE_HEADER
+
+#include "voe/core.h"
+
+/**
+ * @brief Declares an explicit instantiation of ValueOrError<ValueType, ErrorTypes...>
+ *
+ * Translation units that see the declaration do not instantiate the non-template members of
+ * the class and its implementation layers themselves, and use the definitions from the one
+ * translation unit that includes the header with VOE_DEFINE_INSTANTIATIONS defined. The
+ * voe_define_instantiations() CMake function generates such a unit.
+ *
+ * For example, consider the following snippet:
+ * @code
+ * // errors.h
+ * #include "voe/instantiate.h"
+ *
+ * struct IoError { int code; };
+ * struct ParseError { std::string message; };
+ *
+ * VOE_EXTERN_TEMPLATE(std::string, IoError, ParseError);
+ * VOE_EXTERN_TEMPLATE(void, IoError);
+ *
+ * // CMakeLists.txt
+ * voe_define_instantiations(my_target errors.h)
+ * @endcode
+ *
+ * Only the non-template members are covered. The member templates (conversions, Visit, the
+ * monadic operations) and the storage visitors and lambdas they use can not be named in an
+ * explicit instantiation, and are still instantiated by every unit using them. The savings
+ * are only seen in unoptimized builds (bench/instantiation: -24% .text and -13% compile time
+ * for 16 units). Optimizing compilers still instantiate and inline the members into the using
+ * code, so there is no reduction there.
+ *
+ * @note must be used at the global namespace scope
+ */
+#ifdef VOE_DEFINE_INSTANTIATIONS
+#define VOE_EXTERN_TEMPLATE(...) VOE_INSTANTIATE_TEMPLATE(__VA_ARGS__)
+#else
+#define VOE_EXTERN_TEMPLATE(...) VOE_DETAIL_INSTANTIATE(extern template, __VA_ARGS__)
+#endif
+
+/**
+ * @brief Defines an explicit instantiation of ValueOrError<ValueType, ErrorTypes...>
+ * @see VOE_EXTERN_TEMPLATE
+ * @note must be used at the global namespace scope of exactly one translation unit
+ */
+#define VOE_INSTANTIATE_TEMPLATE(...) VOE_DETAIL_INSTANTIATE(template, __VA_ARGS__)
+
+#define VOE_DETAIL_INSTANTIATE(prefix, ...)                                   \
+  prefix struct ::voe::detail_::Traits<__VA_ARGS__>;                          \
+  prefix struct ::voe::detail_::DestructorImpl<__VA_ARGS__>;                  \
+  prefix struct ::voe::detail_::GetValueImpl<__VA_ARGS__>;                    \
+  prefix struct ::voe::detail_::GetErrorImpl<__VA_ARGS__>;                    \
+  prefix struct ::voe::detail_::SetErrorImpl<__VA_ARGS__>;                    \
+  prefix struct ::voe::detail_::ValueConstructorImpl<__VA_ARGS__>;            \
+  prefix struct ::voe::detail_::ConstructorsImpl<__VA_ARGS__>;                \
+  prefix struct ::voe::detail_::AssignmentsImpl<__VA_ARGS__>;                 \
+  prefix struct ::voe::detail_::DiscardErrorImpl<__VA_ARGS__>;                \
+  prefix struct ::voe::detail_::DiscardValueImpl<__VA_ARGS__>;                \
+  prefix struct ::voe::detail_::VisitImpl<__VA_ARGS__>;                       \
+  prefix struct ::voe::detail_::MonadicImpl<__VA_ARGS__>;                     \
+  prefix class ::voe::ValueOrError<__VA_ARGS__>
+
+#endif  // VOE_INSTANTIATE_HEADER
@@ -0,0 +1,490 @@
+#ifndef VOE_KERNELS_HEADER
+#define VOE_KERNELS_HEADER
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Whether the batch operations use the SSE2 and AVX2 kernels
+ *
+ * Enabled by default on x86-64. The AVX2 kernels are selected at runtime if the CPU supports
+ * them. Define as 0 to always use the scalar kernels.
+ */
+#ifndef VOE_BATCH_SIMD
+#if defined(__x86_64__) && defined(__SSE2__)
+#define VOE_BATCH_SIMD 1
+#else
+#define VOE_BATCH_SIMD 0
+#endif
+#endif
+
+#if VOE_BATCH_SIMD
+#include <immintrin.h>
+#endif
+
+namespace voe::detail_ {
+
+template <typename Index>
+size_t ScalarCountAtLeast(const Index* data, size_t size, Index threshold) noexcept {
+  size_t count = 0;
+  for (size_t i = 0; i < size; ++i) {
+    count += data[i] >= threshold;
+  }
+  return count;
+}
+
+template <typename Index>
+size_t ScalarFindAtLeast(const Index* data, size_t size, Index threshold) noexcept {
+  for (size_t i = 0; i < size; ++i) {
+    if (data[i] >= threshold) {
+      return i;
+    }
+  }
+  return size;
+}
+
+template <typename Index>
+size_t ScalarCountEqual(const Index* data, size_t size, Index value) noexcept {
+  size_t count = 0;
+  for (size_t i = 0; i < size; ++i) {
+    count += data[i] == value;
+  }
+  return count;
+}
+
+template <typename Index>
+void ScalarMaskEqual(const Index* data, size_t size, Index value, uint64_t* mask) noexcept {
+  for (size_t word = 0; word * 64 < size; ++word) {
+    const size_t count = std::min<size_t>(64, size - word * 64);
+    uint64_t bits = 0;
+    for (size_t bit = 0; bit < count; ++bit) {
+      bits |= uint64_t{data[word * 64 + bit] == value} << bit;
+    }
+    mask[word] = bits;
+  }
+}
+
+template <typename Index, typename Table, typename OutIndex>
+void ScalarRemap(const Index* data, size_t size, const Table* table, OutIndex* out) noexcept {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = static_cast<OutIndex>(table[data[i]]);
+  }
+}
+
+/**
+ * @brief The kernels evaluating the one byte logical indices
+ *
+ * - count_at_least: the number of indices >= threshold;
+ * - find_at_least: the position of the first index >= threshold, or size if none;
+ * - count_equal: the number of indices == value;
+ * - mask_equal: sets the bit i of the mask iff the index i == value, writes all the
+ *   (size + 63) / 64 words of the mask;
+ * - remap: out[i] = table[index i], the table has 16 entries and all the indices are below 16.
+ */
+struct ByteKernels {
+  size_t (*count_at_least)(const uint8_t* data, size_t size, uint8_t threshold) noexcept;
+  size_t (*find_at_least)(const uint8_t* data, size_t size, uint8_t threshold) noexcept;
+  size_t (*count_equal)(const uint8_t* data, size_t size, uint8_t value) noexcept;
+  void (*mask_equal)(const uint8_t* data, size_t size, uint8_t value, uint64_t* mask) noexcept;
+  void (*remap)(const uint8_t* data, size_t size, const uint8_t* table, uint8_t* out) noexcept;
+};
+
+inline constexpr ByteKernels kScalarByteKernels{
+  ScalarCountAtLeast<uint8_t>,
+  ScalarFindAtLeast<uint8_t>,
+  ScalarCountEqual<uint8_t>,
+  ScalarMaskEqual<uint8_t>,
+  ScalarRemap<uint8_t, uint8_t, uint8_t>,
+};
+
+#if VOE_BATCH_SIMD
+
+// Unsigned x >= threshold is max(x, threshold) == x, there is no unsigned byte comparison
+inline uint32_t Sse2AtLeastBits(const uint8_t* data, __m128i threshold) noexcept {
+  const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(x, threshold), x)));
+}
+
+inline uint32_t Sse2EqualBits(const uint8_t* data, __m128i value) noexcept {
+  const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, value)));
+}
+
+inline size_t Sse2CountAtLeast(const uint8_t* data, size_t size, uint8_t threshold) noexcept {
+  const __m128i broadcast = _mm_set1_epi8(static_cast<char>(threshold));
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    count += std::popcount(Sse2AtLeastBits(data + i, broadcast));
+  }
+  return count + ScalarCountAtLeast(data + i, size - i, threshold);
+}
+
+inline size_t Sse2FindAtLeast(const uint8_t* data, size_t size, uint8_t threshold) noexcept {
+  const __m128i broadcast = _mm_set1_epi8(static_cast<char>(threshold));
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    if (const uint32_t bits = Sse2AtLeastBits(data + i, broadcast)) {
+      return i + std::countr_zero(bits);
+    }
+  }
+  return i + ScalarFindAtLeast(data + i, size - i, threshold);
+}
+
+inline size_t Sse2CountEqual(const uint8_t* data, size_t size, uint8_t value) noexcept {
+  const __m128i broadcast = _mm_set1_epi8(static_cast<char>(value));
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    count += std::popcount(Sse2EqualBits(data + i, broadcast));
+  }
+  return count + ScalarCountEqual(data + i, size - i, value);
+}
+
+inline void Sse2MaskEqual(
+    const uint8_t* data, size_t size, uint8_t value, uint64_t* mask) noexcept
+{
+  const __m128i broadcast = _mm_set1_epi8(static_cast<char>(value));
+  size_t i = 0;
+  for (; i + 64 <= size; i += 64) {
+    mask[i / 64] =
+      uint64_t{Sse2EqualBits(data + i, broadcast)} |
+      uint64_t{Sse2EqualBits(data + i + 16, broadcast)} << 16 |
+      uint64_t{Sse2EqualBits(data + i + 32, broadcast)} << 32 |
+      uint64_t{Sse2EqualBits(data + i + 48, broadcast)} << 48;
+  }
+  ScalarMaskEqual(data + i, size - i, value, mask + i / 64);
+}
+
+inline constexpr ByteKernels kSse2ByteKernels{
+  Sse2CountAtLeast,
+  Sse2FindAtLeast,
+  Sse2CountEqual,
+  Sse2MaskEqual,
+  // The byte shuffle needs SSSE3, which is not a part of x86-64
+  ScalarRemap<uint8_t, uint8_t, uint8_t>,
+};
+
+#define VOE_TARGET_AVX2 gnu::target("avx2,popcnt")
+
+[[VOE_TARGET_AVX2]] inline uint32_t Avx2AtLeastBits(
+    const uint8_t* data, __m256i threshold) noexcept
+{
+  const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  return static_cast<uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(x, threshold), x)));
+}
+
+[[VOE_TARGET_AVX2]] inline uint32_t Avx2EqualBits(const uint8_t* data, __m256i value) noexcept {
+  const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, value)));
+}
+
+[[VOE_TARGET_AVX2]] inline size_t Avx2CountAtLeast(
+    const uint8_t* data, size_t size, uint8_t threshold) noexcept
+{
+  const __m256i broadcast = _mm256_set1_epi8(static_cast<char>(threshold));
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    count += std::popcount(Avx2AtLeastBits(data + i, broadcast));
+  }
+  return count + ScalarCountAtLeast(data + i, size - i, threshold);
+}
+
+[[VOE_TARGET_AVX2]] inline size_t Avx2FindAtLeast(
+    const uint8_t* data, size_t size, uint8_t threshold) noexcept
+{
+  const __m256i broadcast = _mm256_set1_epi8(static_cast<char>(threshold));
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    if (const uint32_t bits = Avx2AtLeastBits(data + i, broadcast)) {
+      return i + std::countr_zero(bits);
+    }
+  }
+  return i + ScalarFindAtLeast(data + i, size - i, threshold);
+}
+
+[[VOE_TARGET_AVX2]] inline size_t Avx2CountEqual(
+    const uint8_t* data, size_t size, uint8_t value) noexcept
+{
+  const __m256i broadcast = _mm256_set1_epi8(static_cast<char>(value));
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    count += std::popcount(Avx2EqualBits(data + i, broadcast));
+  }
+  return count + ScalarCountEqual(data + i, size - i, value);
+}
+
+[[VOE_TARGET_AVX2]] inline void Avx2MaskEqual(
+    const uint8_t* data, size_t size, uint8_t value, uint64_t* mask) noexcept
+{
+  const __m256i broadcast = _mm256_set1_epi8(static_cast<char>(value));
+  size_t i = 0;
+  for (; i + 64 <= size; i += 64) {
+    mask[i / 64] =
+      uint64_t{Avx2EqualBits(data + i, broadcast)} |
+      uint64_t{Avx2EqualBits(data + i + 32, broadcast)} << 32;
+  }
+  ScalarMaskEqual(data + i, size - i, value, mask + i / 64);
+}
+
+[[VOE_TARGET_AVX2]] inline void Avx2Remap(
+    const uint8_t* data, size_t size, const uint8_t* table, uint8_t* out) noexcept
+{
+  const __m256i lookup = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(lookup, x));
+  }
+  ScalarRemap(data + i, size - i, table, out + i);
+}
+
+#undef VOE_TARGET_AVX2
+
+inline constexpr ByteKernels kAvx2ByteKernels{
+  Avx2CountAtLeast,
+  Avx2FindAtLeast,
+  Avx2CountEqual,
+  Avx2MaskEqual,
+  Avx2Remap,
+};
+
+inline const ByteKernels& SelectByteKernels() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    return kAvx2ByteKernels;
+  }
+  return kSse2ByteKernels;
+}
+
+#else
+
+inline const ByteKernels& SelectByteKernels() noexcept { return kScalarByteKernels; }
+
+#endif
+
+/**
+ * @return the best kernels supported by the CPU, selected once
+ */
+inline const ByteKernels& GetByteKernels() noexcept {
+  static const ByteKernels& kernels = SelectByteKernels();
+  return kernels;
+}
+
+/**
+ * @brief Evaluates the logical indices with the byte kernels, or the scalar ones if wider
+ */
+template <typename Index>
+struct IndexKernels {
+  static size_t CountAtLeast(const Index* data, size_t size, size_t threshold) noexcept {
+    if constexpr (sizeof(Index) == 1) {
+      return GetByteKernels().count_at_least(data, size, static_cast<Index>(threshold));
+    } else {
+      return ScalarCountAtLeast(data, size, static_cast<Index>(threshold));
+    }
+  }
+
+  static size_t FindAtLeast(const Index* data, size_t size, size_t threshold) noexcept {
+    if constexpr (sizeof(Index) == 1) {
+      return GetByteKernels().find_at_least(data, size, static_cast<Index>(threshold));
+    } else {
+      return ScalarFindAtLeast(data, size, static_cast<Index>(threshold));
+    }
+  }
+
+  static size_t CountEqual(const Index* data, size_t size, size_t value) noexcept {
+    if constexpr (sizeof(Index) == 1) {
+      return GetByteKernels().count_equal(data, size, static_cast<Index>(value));
+    } else {
+      return ScalarCountEqual(data, size, static_cast<Index>(value));
+    }
+  }
+
+  static void MaskEqual(const Index* data, size_t size, size_t value, uint64_t* mask) noexcept {
+    if constexpr (sizeof(Index) == 1) {
+      GetByteKernels().mask_equal(data, size, static_cast<Index>(value), mask);
+    } else {
+      ScalarMaskEqual(data, size, static_cast<Index>(value), mask);
+    }
+  }
+
+  /**
+   * @brief Sets out[i] = mapping[data[i]], the mapped indices must fit into OutIndex
+   */
+  template <typename OutIndex, size_t Size>
+  static void Remap(
+      const Index* data,
+      size_t size,
+      const std::array<size_t, Size>& mapping,
+      OutIndex* out) noexcept
+  {
+    if constexpr (sizeof(Index) == 1 && sizeof(OutIndex) == 1 && Size <= 16) {
+      uint8_t table[16]{};
+      for (size_t i = 0; i < Size; ++i) {
+        table[i] = static_cast<uint8_t>(mapping[i]);
+      }
+      GetByteKernels().remap(data, size, table, out);
+    } else {
+      ScalarRemap(data, size, mapping.data(), out);
+    }
+  }
+};
+
+// The bit planes of the codes of 256 rows are stored in a block, 4 words per plane, see StatusArray
+inline constexpr size_t kPlaneBlockRows = 256;
+inline constexpr size_t kPlaneWords = kPlaneBlockRows / 64;
+
+// Matches the rows of any non-zero code
+inline constexpr size_t kAnyNonzeroCode = size_t(-1);
+
+/**
+ * @return the bits of the rows of the block word matching the code
+ */
+inline uint64_t ScalarPlanesMatch(
+    const uint64_t* block, size_t planes, size_t code, size_t word) noexcept
+{
+  if (code == kAnyNonzeroCode) {
+    uint64_t bits = 0;
+    for (size_t plane = 0; plane < planes; ++plane) {
+      bits |= block[plane * kPlaneWords + word];
+    }
+    return bits;
+  }
+  uint64_t bits = ~uint64_t{0};
+  for (size_t plane = 0; plane < planes; ++plane) {
+    // The plane bits are inverted where the code bit is 0
+    bits &= block[plane * kPlaneWords + word] ^ (uint64_t{(code >> plane) & 1} - 1);
+  }
+  return bits;
+}
+
+inline size_t ScalarCountPlanes(
+    const uint64_t* words, size_t blocks, size_t planes, size_t code) noexcept
+{
+  size_t count = 0;
+  for (size_t block = 0; block < blocks; ++block) {
+    for (size_t word = 0; word < kPlaneWords; ++word) {
+      count += std::popcount(
+          ScalarPlanesMatch(words + block * planes * kPlaneWords, planes, code, word));
+    }
+  }
+  return count;
+}
+
+inline size_t ScalarFindPlanes(
+    const uint64_t* words, size_t blocks, size_t planes, size_t code) noexcept
+{
+  for (size_t block = 0; block < blocks; ++block) {
+    for (size_t word = 0; word < kPlaneWords; ++word) {
+      const uint64_t bits =
+        ScalarPlanesMatch(words + block * planes * kPlaneWords, planes, code, word);
+      if (bits != 0) {
+        return block * kPlaneBlockRows + word * 64 + std::countr_zero(bits);
+      }
+    }
+  }
+  return blocks * kPlaneBlockRows;
+}
+
+/**
+ * @brief The kernels evaluating the bit planes of the row codes, stored in blocks
+ *
+ * - count: the number of rows matching the code, or any non-zero code if kAnyNonzeroCode;
+ * - find: the first row matching the code, or blocks * kPlaneBlockRows if none.
+ */
+struct PlaneKernels {
+  size_t (*count)(const uint64_t* words, size_t blocks, size_t planes, size_t code) noexcept;
+  size_t (*find)(const uint64_t* words, size_t blocks, size_t planes, size_t code) noexcept;
+};
+
+inline constexpr PlaneKernels kScalarPlaneKernels{ScalarCountPlanes, ScalarFindPlanes};
+
+#if VOE_BATCH_SIMD
+
+#define VOE_TARGET_AVX2 gnu::target("avx2,popcnt")
+
+[[VOE_TARGET_AVX2]] inline __m256i Avx2LoadPlane(const uint64_t* block, size_t plane) noexcept {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + plane * kPlaneWords));
+}
+
+[[VOE_TARGET_AVX2]] inline __m256i Avx2PlanesMatch(
+    const uint64_t* block, size_t planes, size_t code) noexcept
+{
+  if (code == kAnyNonzeroCode) {
+    __m256i bits = _mm256_setzero_si256();
+    for (size_t plane = 0; plane < planes; ++plane) {
+      bits = _mm256_or_si256(bits, Avx2LoadPlane(block, plane));
+    }
+    return bits;
+  }
+  __m256i bits = _mm256_set1_epi64x(-1);
+  for (size_t plane = 0; plane < planes; ++plane) {
+    const __m256i invert = _mm256_set1_epi64x(static_cast<long long>(((code >> plane) & 1) - 1));
+    bits = _mm256_and_si256(bits, _mm256_xor_si256(Avx2LoadPlane(block, plane), invert));
+  }
+  return bits;
+}
+
+[[VOE_TARGET_AVX2]] inline size_t Avx2CountPlanes(
+    const uint64_t* words, size_t blocks, size_t planes, size_t code) noexcept
+{
+  size_t count = 0;
+  for (size_t block = 0; block < blocks; ++block) {
+    const __m256i bits = Avx2PlanesMatch(words + block * planes * kPlaneWords, planes, code);
+    count += std::popcount(static_cast<uint64_t>(_mm256_extract_epi64(bits, 0)));
+    count += std::popcount(static_cast<uint64_t>(_mm256_extract_epi64(bits, 1)));
+    count += std::popcount(static_cast<uint64_t>(_mm256_extract_epi64(bits, 2)));
+    count += std::popcount(static_cast<uint64_t>(_mm256_extract_epi64(bits, 3)));
+  }
+  return count;
+}
+
+[[VOE_TARGET_AVX2]] inline size_t Avx2FindPlanes(
+    const uint64_t* words, size_t blocks, size_t planes, size_t code) noexcept
+{
+  for (size_t block = 0; block < blocks; ++block) {
+    const __m256i bits = Avx2PlanesMatch(words + block * planes * kPlaneWords, planes, code);
+    if (!_mm256_testz_si256(bits, bits)) {
+      return block * kPlaneBlockRows +
+        ScalarFindPlanes(words + block * planes * kPlaneWords, 1, planes, code);
+    }
+  }
+  return blocks * kPlaneBlockRows;
+}
+
+#undef VOE_TARGET_AVX2
+
+inline constexpr PlaneKernels kAvx2PlaneKernels{Avx2CountPlanes, Avx2FindPlanes};
+
+inline const PlaneKernels& SelectPlaneKernels() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    return kAvx2PlaneKernels;
+  }
+  return kScalarPlaneKernels;
+}
+
+#else
+
+inline const PlaneKernels& SelectPlaneKernels() noexcept { return kScalarPlaneKernels; }
+
+#endif
+
+/**
+ * @return the best plane kernels supported by the CPU, selected once
+ */
+inline const PlaneKernels& GetPlaneKernels() noexcept {
+  static const PlaneKernels& kernels = SelectPlaneKernels();
+  return kernels;
+}
+
+}  // namespace voe::detail_
+
+#endif  // VOE_KERNELS_HEADER
@@ -0,0 +1,28 @@
+#ifndef VOE_MACROS_HEADER
+#define VOE_MACROS_HEADER
+
+#include <utility>
+
+#include "voe/contract.h"
+
+#define RETURN_IF_ERROR(expr)             \
+  do {                                    \
+    auto&& err = (expr);                  \
+    if (err.HasAnyError()) [[unlikely]] { \
+      return err.DiscardValue();          \
+    }                                     \
+  } while (0)                             \
+
+#define ASSIGN_OR_RETURN_ERROR(var, expr)  \
+  do {                                     \
+    auto&& err = (expr);                   \
+    if (err.HasAnyError()) [[unlikely]] {  \
+      return err.DiscardValue();           \
+    }                                      \
+    VOE_CONTRACT_CHECK(                    \
+        !err.IsEmpty(),                    \
+        "expression is empty");            \
+    var = std::move(err.GetValue());       \
+  } while (0)
+
+#endif  // VOE_MACROS_HEADER
@@ -0,0 +1,190 @@
+#ifndef VOE_PARALLEL_HEADER
+#define VOE_PARALLEL_HEADER
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "voe/core.h"
+
+namespace voe {
+
+/**
+ * @brief The execution policy of ParallelTransform
+ *
+ * A result holding an error of any of FatalErrorTypes... stops the whole transform, e.g.
+ * ParallelPolicy<Unauthorized>{.threads = 8}. The other errors are kept in the results.
+ */
+template <typename... FatalErrorTypes>
+struct ParallelPolicy {
+  // The number of threads, including the calling one. 0 stands for hardware_concurrency()
+  size_t threads = 0;
+  // The number of consecutive inputs a thread claims at once
+  size_t chunk_size = 64;
+};
+
+namespace detail_ {
+
+template <typename Inputs, typename Callable>
+using ParallelResult = std::remove_cvref_t<
+  std::invoke_result_t<Callable&, std::ranges::range_reference_t<Inputs>>>;
+
+inline constexpr size_t kNoStopIndex = size_t(-1);
+
+// The state shared by the threads of a ParallelTransform
+template <typename Iterator, typename Callable, typename Result, typename... FatalErrorTypes>
+struct ParallelTransformState {
+  ParallelTransformState(
+      Iterator inputs, Callable& callable, Result* results, size_t size, size_t chunk_size)
+    : inputs(inputs)
+    , callable(callable)
+    , results(results)
+    , size(size)
+    , chunk_size(chunk_size)
+  {}
+
+  Iterator inputs;
+  Callable& callable;
+  Result* results;
+  size_t size;
+  size_t chunk_size;
+
+  // The chunks are claimed in the order of the inputs, so that every input before the stop
+  // index is transformed, and the reported fatal error is the first one in the inputs
+  std::atomic<size_t> next_chunk{0};
+  std::atomic<size_t> stop_index{kNoStopIndex};
+
+  std::mutex exception_mutex;
+  std::exception_ptr exception;
+
+  void Run() noexcept {
+    for (;;) {
+      const size_t begin = next_chunk.fetch_add(chunk_size, std::memory_order_relaxed);
+      const size_t end = std::min(size, begin + chunk_size);
+      for (size_t index = begin; index < end; ++index) {
+        if (index > stop_index.load(std::memory_order_relaxed)) {
+          return;
+        }
+        if (!Transform(index)) {
+          return;
+        }
+      }
+      if (end == size) {
+        return;
+      }
+    }
+  }
+
+  // @return whether the transform should go on
+  bool Transform(size_t index) noexcept {
+    try {
+      results[index] = std::invoke(callable, inputs[index]);
+    } catch (...) {
+      {
+        std::lock_guard lock(exception_mutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+      stop_index.store(0, std::memory_order_relaxed);
+      return false;
+    }
+    if constexpr (sizeof...(FatalErrorTypes) != 0) {
+      if (results[index].template HasAnyOf<FatalErrorTypes...>()) [[unlikely]] {
+        size_t current = stop_index.load(std::memory_order_relaxed);
+        while (index < current
+               && !stop_index.compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+        }
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace detail_
+
+/**
+ * @brief Transforms the inputs in parallel, stopping all the threads on a fatal error
+ *
+ * Invokes the callable on each of the inputs, concurrently from several threads, and writes
+ * the results directly into a preallocated vector, in the order of the inputs. The threads
+ * claim chunks of policy.chunk_size consecutive inputs from a shared counter, so the faster
+ * threads take over the work left by the slower ones.
+ *
+ * As soon as a result holds an error of the FatalErrorTypes... of the policy, a shared atomic
+ * stop index makes the threads skip the remaining inputs. Then the fatal error of the first
+ * such input is returned (it is the same as the one a sequential loop would stop at).
+ * Otherwise all the results are returned, including the ones holding the other errors.
+ *
+ * The callable must be safe to invoke concurrently. If it throws, the threads stop and the
+ * first exception is rethrown.
+ *
+ * @note value_or_error.h does not include this header, as it needs std::thread (link the
+ *       value_or_error_parallel CMake target)
+ *
+ * @code
+ * ValueOrError<std::vector<ValueOrError<Page, NotFound, Unauthorized>>, Unauthorized> pages =
+ *   ParallelTransform(urls, Fetch, ParallelPolicy<Unauthorized>{.threads = 16});
+ * @endcode
+ */
+template <typename Inputs, typename Callable, typename... FatalErrorTypes>
+  requires std::ranges::random_access_range<Inputs>
+        && std::ranges::sized_range<Inputs>
+        && detail_::IsValueOrError<detail_::ParallelResult<Inputs, Callable>>
+        && std::is_default_constructible_v<detail_::ParallelResult<Inputs, Callable>>
+        && detail_::SubsetOf<
+             detail_::VariadicHolder<FatalErrorTypes...>,
+             detail_::ErrorTypes<detail_::ParallelResult<Inputs, Callable>>>::value
+ValueOrError<std::vector<detail_::ParallelResult<Inputs, Callable>>, FatalErrorTypes...>
+ParallelTransform(
+    Inputs&& inputs,
+    Callable&& callable,
+    ParallelPolicy<FatalErrorTypes...> policy = {})
+{
+  using Result = detail_::ParallelResult<Inputs, Callable>;
+  using Output = ValueOrError<std::vector<Result>, FatalErrorTypes...>;
+  using State = detail_::ParallelTransformState<
+    std::ranges::iterator_t<Inputs>, std::remove_reference_t<Callable>, Result,
+    FatalErrorTypes...>;
+
+  const size_t size = std::ranges::size(inputs);
+  std::vector<Result> results(size);
+  const size_t chunk_size = std::max<size_t>(policy.chunk_size, 1);
+  State state(std::ranges::begin(inputs), callable, results.data(), size, chunk_size);
+
+  const size_t threads = policy.threads != 0
+    ? policy.threads
+    : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  const size_t workers = std::min(threads, (size + chunk_size - 1) / chunk_size);
+  if (workers > 1) {
+    std::vector<std::jthread> helpers;
+    helpers.reserve(workers - 1);
+    for (size_t worker = 1; worker < workers; ++worker) {
+      helpers.emplace_back([&state] { state.Run(); });
+    }
+    state.Run();
+  } else if (size != 0) {
+    state.Run();
+  }
+
+  if (state.exception) {
+    std::rethrow_exception(state.exception);
+  }
+  const size_t stop_index = state.stop_index.load(std::memory_order_relaxed);
+  if (stop_index != detail_::kNoStopIndex) {
+    return Output(detail_::UncheckedConvertTag{}, std::move(results[stop_index]));
+  }
+  return Output(std::move(results));
+}
+
+}  // namespace voe
+
+#endif  // VOE_PARALLEL_HEADER
@@ -0,0 +1,165 @@
+#ifndef VOE_PIPELINE_HEADER
+#define VOE_PIPELINE_HEADER
+
+#include <tuple>
+
+#include "voe/core.h"
+
+namespace voe {
+
+namespace detail_ {
+
+template <typename StepResult>
+struct PipelineStepTraits {
+  using ValueType = StepResult;
+  using ErrorTypes = VariadicHolder<>;
+};
+
+template <typename ValueType_, typename... ErrorTypes_>
+struct PipelineStepTraits<ValueOrError<ValueType_, ErrorTypes_...>> {
+  using ValueType = ValueType_;
+  using ErrorTypes = VariadicHolder<ErrorTypes_...>;
+};
+
+template <typename ValueType>
+struct PipelineArgsHolder { using type = VariadicHolder<ValueType&&>; };
+
+template <>
+struct PipelineArgsHolder<void> { using type = VariadicHolder<>; };
+
+template <typename... Args>
+struct PipelineValueHolder { using type = void; };
+
+template <typename Arg>
+struct PipelineValueHolder<Arg> { using type = std::remove_cvref_t<Arg>; };
+
+template <typename Args, typename... Steps>
+struct PipelineResultHolder;
+
+template <typename... Args>
+struct PipelineResultHolder<VariadicHolder<Args...>> {
+  using ValueType = typename PipelineValueHolder<Args...>::type;
+  using ErrorTypes = VariadicHolder<>;
+};
+
+template <typename... Args, typename Step, typename... Steps>
+struct PipelineResultHolder<VariadicHolder<Args...>, Step, Steps...> {
+  using StepTraits =
+    PipelineStepTraits<Flat<std::remove_cvref_t<std::invoke_result_t<const Step&, Args...>>>>;
+  using Rest = PipelineResultHolder<
+    typename PipelineArgsHolder<typename StepTraits::ValueType>::type, Steps...>;
+
+  using ValueType = typename Rest::ValueType;
+  using ErrorTypes = Union<typename StepTraits::ErrorTypes, typename Rest::ErrorTypes>;
+};
+
+template <typename Args, typename... Steps>
+using PipelineResult = TransferTemplate<
+  typename PipelineResultHolder<Args, Steps...>::ErrorTypes,
+  ValueOrError, typename PipelineResultHolder<Args, Steps...>::ValueType>;
+
+}  // namespace detail_
+
+/**
+ * @brief A lazily evaluated composition of steps
+ *
+ * Each step is a callable accepting the value produced by the previous step (or the pipeline
+ * arguments for the first step, or nothing if the previous step produced void) and returning
+ * either a plain value or a ValueOrError. Running the pipeline invokes the steps one by one,
+ * passing the moved values between them. The first step that returns an error (or an empty
+ * non-void ValueOrError) stops the pipeline, and its error is moved directly to the result.
+ *
+ * No intermediate objects of the resulting type are created, so the pipeline is equivalent
+ * to hand-written code that returns early on every step.
+ *
+ * @see Pipe
+ */
+template <typename... Steps>
+class Pipeline {
+ public:
+  /**
+   * @brief The type returned by running the pipeline with Args...
+   *
+   * Its ValueType is the value type of the last step and its ErrorTypes... are the union of all
+   * steps' error types (see voe::Union).
+   */
+  template <typename... Args>
+  using ResultType = detail_::PipelineResult<detail_::VariadicHolder<Args&&...>, Steps...>;
+
+  constexpr explicit Pipeline(Steps... steps) : steps_(std::move(steps)...) {}
+
+  /**
+   * @brief Runs the pipeline
+   * @param args arguments of the first step (at most one)
+   */
+  template <typename... Args>
+    requires (sizeof...(Args) <= 1)
+  ResultType<Args...> operator()(Args&&... args) const {
+    return Run<0, ResultType<Args...>>(std::forward<Args>(args)...);
+  }
+
+ private:
+  template <size_t Index, typename Result, typename... Args>
+  Result Run(Args&&... args) const {
+    if constexpr (Index == sizeof...(Steps)) {
+      return Result(std::forward<Args>(args)...);
+    } else {
+      using Step = std::tuple_element_t<Index, std::tuple<Steps...>>;
+      using StepResult = std::invoke_result_t<const Step&, Args...>;
+      const Step& step = std::get<Index>(steps_);
+
+      if constexpr (std::is_same_v<void, StepResult>) {
+        std::invoke(step, std::forward<Args>(args)...);
+        return Run<Index + 1, Result>();
+      } else if constexpr (!detail_::IsValueOrError<StepResult>) {
+        return Run<Index + 1, Result>(std::invoke(step, std::forward<Args>(args)...));
+      } else if constexpr (!std::is_same_v<
+            std::remove_cvref_t<StepResult>, Flat<std::remove_cvref_t<StepResult>>>) {
+        return Propagate<Index, Result>(
+            detail_::FlattenInto<Flat<std::remove_cvref_t<StepResult>>>(
+                std::invoke(step, std::forward<Args>(args)...)));
+      } else {
+        return Propagate<Index, Result>(std::invoke(step, std::forward<Args>(args)...));
+      }
+    }
+  }
+
+  template <size_t Index, typename Result, typename StepResult>
+  Result Propagate(StepResult&& result) const {
+    if constexpr (std::is_same_v<void, typename std::remove_cvref_t<StepResult>::value_type>) {
+      if (result.HasAnyError()) [[unlikely]] {
+        return Result(detail_::UncheckedConvertTag{}, std::forward<StepResult>(result));
+      }
+      return Run<Index + 1, Result>();
+    } else {
+      if (!result.HasValue()) [[unlikely]] {
+        return Result(detail_::UncheckedConvertTag{}, std::forward<StepResult>(result));
+      }
+      return Run<Index + 1, Result>(std::forward<StepResult>(result).GetValue());
+    }
+  }
+
+  std::tuple<Steps...> steps_;
+};
+
+/**
+ * @brief Composes the steps into a lazily evaluated Pipeline
+ *
+ * For example, consider the following snippet:
+ * @code
+ * ValueOrError<Config, ReadError> Read(const char* path);
+ * ValueOrError<Config, ParseError> Validate(Config&& config);
+ * Server Start(Config&& config);
+ *
+ * auto start = Pipe(Read, Validate, Start);
+ * ValueOrError<Server, ReadError, ParseError> server = start("config.json");
+ * @endcode
+ */
+template <typename... Steps>
+constexpr Pipeline<std::decay_t<Steps>...> Pipe(Steps&&... steps) {
+  return Pipeline<std::decay_t<Steps>...>(std::forward<Steps>(steps)...);
+}
+
+}  // namespace voe
+
+#endif  // VOE_PIPELINE_HEADER
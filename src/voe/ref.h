@@ -0,0 +1,228 @@
+#ifndef VOE_REF_HEADER
+#define VOE_REF_HEADER
+
+#include "voe/core.h"
+
+namespace voe {
+
+namespace detail_ {
+
+struct StorageRefTag {};
+
+}  // namespace detail_
+
+/**
+ * @brief A non-owning read-only view of a ValueOrError object
+ *
+ * The view consists of a pointer to the viewed object's storage and the logical index
+ * of the held alternative, expressed in terms of this view's own ErrorTypes... list.
+ * It can be created from any ValueOrError that is convertible to
+ * ValueOrError<ValueType, ErrorTypes...> (see ValueOrError conversion constructor),
+ * so a single non-template function accepting ValueOrErrorRef<V, E...> serves every
+ * ValueOrError<V, E'...> with E' being a subset of E. Creating the view never copies
+ * the viewed value or error, the index is remapped once on construction.
+ *
+ * The viewed object must outlive the view and must not be modified while it is viewed.
+ */
+template <typename ValueType, typename... ErrorTypes>
+class ValueOrErrorRef {
+  using Traits = detail_::Traits<ValueType, ErrorTypes...>;
+  using IndexType = std::remove_cvref_t<decltype(std::declval<const Traits&>().LogicalIndex())>;
+
+ public:
+  using value_type = ValueType;
+  static_assert(detail_::AllDecayed<ValueType, ErrorTypes...>, "All types must be decayed");
+  static_assert(detail_::AllUnique<ErrorTypes...>, "Error types must not contain duplicates");
+
+  /**
+   * @brief Creates a view of the specified ValueOrError object
+   * @exception (UB) from holds a value, and this type's ValueType is void
+   */
+  template <typename FromValueType, typename... FromErrorTypes>
+    requires detail_::Convertible<
+        detail_::VariadicHolder<FromValueType, FromErrorTypes...>,
+        detail_::VariadicHolder<ValueType, ErrorTypes...>
+    >
+  /* implicit */ ValueOrErrorRef(
+      const ValueOrError<FromValueType, FromErrorTypes...>& from) noexcept
+    : data_(&from.Data())
+    , index_(RemapIndex(from))
+  {}
+
+  /**
+   * @brief Creates a view of a value or an error stored outside of a ValueOrError object
+   *
+   * It is used by the containers that store the alternatives separately, see ValueOrErrorVector.
+   * The data must point to the alternative with the specified logical index, or be null if the
+   * index is the empty one.
+   */
+  constexpr ValueOrErrorRef(detail_::StorageRefTag, const void* data, IndexType index) noexcept
+    : data_(data)
+    , index_(index)
+  {}
+
+  ValueOrErrorRef(const ValueOrErrorRef&) noexcept = default;
+  ValueOrErrorRef& operator=(const ValueOrErrorRef&) noexcept = default;
+
+  /**
+   * @return whether the viewed object neither holds a value nor an error (is empty)
+   */
+  constexpr bool IsEmpty() const noexcept {
+    if constexpr (Traits::NeverEmpty) {
+      return false;
+    } else {
+      return index_ == Traits::LogicalEmptyIndex();
+    }
+  }
+
+  /**
+   * @return whether the viewed object holds a value.
+   */
+  constexpr bool HasValue() const noexcept {
+    if constexpr (std::is_same_v<void, ValueType>) {
+      return false;
+    } else {
+      return index_ == Traits::LogicalValueIndex();
+    }
+  }
+
+  /**
+   * @return whether the viewed object holds any error
+   */
+  constexpr bool HasAnyError() const noexcept {
+    return index_ >= Traits::LogicalFirstErrorIndex();
+  }
+
+  /**
+   * @return the index of the viewed error in ErrorTypes... list
+   * @exception UB if !HasAnyError()
+   */
+  size_t GetErrorIndex() const noexcept {
+    VOE_CONTRACT_CHECK(HasAnyError(), "GetErrorIndex() called on object with no error");
+    return index_ - Traits::LogicalFirstErrorIndex();
+  }
+
+  /**
+   * @return whether the viewed object holds an error with the specified type
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  bool HasError() const noexcept {
+    return index_ == Traits::template LogicalErrorIndex<ErrorType>();
+  }
+
+  /**
+   * @return whether the viewed object holds an error of any of the specified types
+   * @see ValueOrError::HasAnyOf
+   */
+  template <typename... Selected>
+    requires (... && detail_::TypesContain<Selected, ErrorTypes...>)
+  bool HasAnyOf() const noexcept {
+    using Sets = detail_::ErrorIndexSets<Traits, ErrorTypes...>;
+    return detail_::InIndexSet<Sets::Size, Sets::template Of<Selected...>>(index_);
+  }
+
+  /**
+   * @return whether the viewed object holds an error of the specified category
+   * @see ValueOrError::HasErrorIn
+   */
+  template <typename Category>
+  bool HasErrorIn() const noexcept {
+    using Sets = detail_::ErrorIndexSets<Traits, ErrorTypes...>;
+    return detail_::InIndexSet<Sets::Size, Sets::template In<Category>>(index_);
+  }
+
+  /**
+   * @return a const reference to the viewed value
+   * @exception UB is HasValue() == false
+   */
+  const auto& GetValue() const noexcept requires (!std::is_same_v<void, ValueType>) {
+    VOE_CONTRACT_CHECK(HasValue(), "GetValue() called on object with no value");
+    return *static_cast<const ValueType*>(data_);
+  }
+
+  /**
+   * @return const reference to the viewed error object of the specified type
+   * @exception UB if !HasError<ErrorType>()
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  const ErrorType& GetError() const noexcept {
+    VOE_CONTRACT_CHECK(HasError<ErrorType>(), "GetError<E>() called on object with no error E");
+    return *static_cast<const ErrorType*>(data_);
+  }
+
+  /**
+   * @return const reference to the viewed error with type ErrorType<Index>
+   * @exception UB if !HasError<ErrorType<Index>>()
+   */
+  template <size_t Index>
+  const detail_::IndexToType<Index, ErrorTypes...>& GetError() const noexcept {
+    using ErrorType = detail_::IndexToType<Index, ErrorTypes...>;
+    VOE_CONTRACT_CHECK(HasError<ErrorType>(), "GetError<I>() called on object with no error E[I]");
+    return *static_cast<const ErrorType*>(data_);
+  }
+
+  /**
+   * @brief Visit paradigm implementation for ValueOrErrorRef objects
+   * @see ValueOrError::Visit, the visitor is called the same way as for the viewed object
+   * @exception UB if ValueType is not void and the viewed object is empty
+   */
+  template <typename Visitor>
+  decltype(auto) Visit(Visitor&& visitor) const {
+    auto visit_stored = [&](auto index) -> decltype(auto) {
+      using Type = typename Traits::template StoredType<index>;
+      return std::forward<Visitor>(visitor)(*static_cast<const Type*>(data_));
+    };
+    if constexpr (std::is_same_v<void, ValueType>) {
+      if constexpr (Traits::StoredCount > 0) {
+        if (HasAnyError()) {
+          return detail_::Dispatch<Traits::StoredCount>(
+              Traits::LogicalToPhysicalIndex(index_), visit_stored);
+        }
+      }
+      return std::forward<Visitor>(visitor)();
+    } else {
+      VOE_CONTRACT_CHECK(!IsEmpty(), "Visit() called on an empty object");
+      return detail_::Dispatch<Traits::StoredCount>(
+          Traits::LogicalToPhysicalIndex(index_), visit_stored);
+    }
+  }
+
+ private:
+  template <typename FromValueType, typename... FromErrorTypes>
+  static IndexType RemapIndex(const ValueOrError<FromValueType, FromErrorTypes...>& from) noexcept {
+    using FromType = ValueOrError<FromValueType, FromErrorTypes...>;
+    if constexpr (std::is_same_v<FromType, ValueOrError<ValueType, ErrorTypes...>>) {
+      return from.LogicalIndex();
+    } else {
+      if constexpr (!Traits::NeverEmpty) {
+        if (from.IsEmpty()) {
+          return Traits::LogicalEmptyIndex();
+        }
+      }
+      using PhysicalIndexMapping =
+        typename detail_::IndexMapping<typename FromType::StoredTypes>
+        ::template MapTo<typename Traits::StoredTypes>;
+
+      const size_t this_phys_index = PhysicalIndexMapping::indices[from.PhysicalIndex()];
+      VOE_CONTRACT_CHECK(
+          this_phys_index != size_t(-1),
+          "ValueOrErrorRef<void, ...> is trying to view a value");
+      return static_cast<IndexType>(Traits::PhysicalToLogicalIndex(this_phys_index));
+    }
+  }
+
+  const void* data_;
+  IndexType index_;
+};
+
+/**
+ * @brief A shorter type template alias for views of void-returning functions' results
+ */
+template <typename... ErrorTypes>
+using VoidOrErrorRef = ValueOrErrorRef<void, ErrorTypes...>;
+
+}  // namespace voe
+
+#endif  // VOE_REF_HEADER
@@ -0,0 +1,318 @@
+#ifndef VOE_STATUS_ARRAY_HEADER
+#define VOE_STATUS_ARRAY_HEADER
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "voe/core.h"
+#include "voe/kernels.h"
+
+namespace voe {
+
+template <typename Status>
+class StatusArray;
+
+/**
+ * @brief A sequence of VoidOrError<ErrorTypes...> statuses, bit-packed
+ *
+ * The error types must be empty tags, so that a status is fully described by its code: 0 for
+ * a success, or 1 + the physical index of the held error. Each of the codes takes
+ * bit_width(sizeof...(ErrorTypes)) bits, e.g. 3 bits for 5 error types, instead of the whole
+ * byte of the VoidOrError object.
+ *
+ * The codes are stored as bit planes: the bits k of the codes of 256 consecutive rows form
+ * the k-th plane of their block. Counting or finding the rows holding an error evaluates a
+ * block with a few bitwise operations and popcounts, using the AVX2 kernels if the CPU supports
+ * them (see VOE_BATCH_SIMD), and merging two arrays is a bitwise operation over the planes.
+ *
+ * The statuses are read as VoidOrError objects, and modified through the Reference proxies.
+ */
+template <typename... ErrorTypes>
+  requires (... && (std::is_empty_v<ErrorTypes> && std::is_default_constructible_v<ErrorTypes>))
+class StatusArray<ValueOrError<void, ErrorTypes...>> {
+  using Traits = detail_::Traits<void, ErrorTypes...>;
+
+  static constexpr size_t kPlanes = std::bit_width(sizeof...(ErrorTypes));
+  static constexpr size_t kBlockWords = kPlanes * detail_::kPlaneWords;
+
+ public:
+  using value_type = ValueOrError<void, ErrorTypes...>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(detail_::AllDecayed<ErrorTypes...>, "All types must be decayed");
+  static_assert(detail_::AllUnique<ErrorTypes...>, "Error types must not contain duplicates");
+
+  /**
+   * @brief A proxy of the status at a row, convertible to and assignable from VoidOrError
+   */
+  class Reference {
+   public:
+    Reference(const Reference&) noexcept = default;
+
+    /* implicit */ operator value_type() const noexcept {
+      return FromCode(array_->GetCode(row_));
+    }
+
+    Reference& operator=(const value_type& status) noexcept {
+      array_->SetCode(row_, Code(status));
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other) noexcept {
+      array_->SetCode(row_, other.array_->GetCode(other.row_));
+      return *this;
+    }
+
+   private:
+    friend class StatusArray;
+
+    Reference(StatusArray* array, size_t row) noexcept
+      : array_(array)
+      , row_(row)
+    {}
+
+    StatusArray* array_;
+    size_t row_;
+  };
+
+  /**
+   * @brief A random access iterator over the statuses, yielding VoidOrError objects
+   */
+  class Iterator {
+   public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = ValueOrError<void, ErrorTypes...>;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() noexcept = default;
+
+    value_type operator*() const noexcept { return (*array_)[row_]; }
+    value_type operator[](difference_type offset) const noexcept {
+      return (*array_)[row_ + offset];
+    }
+
+    Iterator& operator++() noexcept { ++row_; return *this; }
+    Iterator operator++(int) noexcept { Iterator copy = *this; ++row_; return copy; }
+    Iterator& operator--() noexcept { --row_; return *this; }
+    Iterator operator--(int) noexcept { Iterator copy = *this; --row_; return copy; }
+
+    Iterator& operator+=(difference_type offset) noexcept { row_ += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { row_ -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return static_cast<difference_type>(lhs.row_ - rhs.row_);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.row_ == rhs.row_;
+    }
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.row_ <=> rhs.row_;
+    }
+
+   private:
+    friend class StatusArray;
+
+    Iterator(const StatusArray* array, size_t row) noexcept
+      : array_(array)
+      , row_(row)
+    {}
+
+    const StatusArray* array_{nullptr};
+    size_t row_{0};
+  };
+
+  StatusArray() = default;
+
+  /**
+   * @brief Creates the array of the specified number of successes
+   */
+  explicit StatusArray(size_t size) { resize(size); }
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  void reserve(size_t capacity) { words_.reserve(BlockCount(capacity) * kBlockWords); }
+
+  /**
+   * @brief Resizes the array, the added statuses are successes
+   */
+  void resize(size_t size) {
+    // The rows past the end are kept as successes, so the blocks can be evaluated as a whole
+    for (size_t row = size; row < std::min(size_, BlockCount(size) * detail_::kPlaneBlockRows);
+         ++row) {
+      SetCode(row, 0);
+    }
+    words_.resize(BlockCount(size) * kBlockWords);
+    size_ = size;
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Appends the specified status
+   */
+  void push_back(const value_type& status) {
+    if (size_ % detail_::kPlaneBlockRows == 0) {
+      words_.resize(words_.size() + kBlockWords);
+    }
+    SetCode(size_++, Code(status));
+  }
+
+  /**
+   * @return the status at the specified row
+   * @exception UB if row >= size()
+   */
+  value_type operator[](size_t row) const noexcept {
+    VOE_CONTRACT_CHECK(row < size_, "StatusArray row is out of range");
+    return FromCode(GetCode(row));
+  }
+
+  /**
+   * @return a proxy of the status at the specified row
+   * @exception UB if row >= size()
+   */
+  Reference operator[](size_t row) noexcept {
+    VOE_CONTRACT_CHECK(row < size_, "StatusArray row is out of range");
+    return Reference(this, row);
+  }
+
+  Iterator begin() const noexcept { return Iterator(this, 0); }
+  Iterator end() const noexcept { return Iterator(this, size_); }
+
+  /**
+   * @return whether none of the statuses holds an error
+   */
+  bool AllOk() const noexcept { return FindFirstError() == size_; }
+
+  /**
+   * @return the number of the statuses holding an error
+   */
+  size_t CountErrors() const noexcept { return Count(detail_::kAnyNonzeroCode); }
+
+  /**
+   * @return the number of the statuses holding the specified error
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  size_t CountErrors() const noexcept {
+    return Count(ErrorCode<ErrorType>());
+  }
+
+  /**
+   * @return the row of the first status holding an error, or size() if none
+   */
+  size_t FindFirstError() const noexcept { return Find(detail_::kAnyNonzeroCode); }
+
+  /**
+   * @return the row of the first status holding the specified error, or size() if none
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  size_t FindError() const noexcept {
+    return Find(ErrorCode<ErrorType>());
+  }
+
+  /**
+   * @brief Combines the statuses of two checks of the same rows
+   *
+   * Each of the statuses becomes the status of the row passing both checks: the error of this
+   * array is kept, otherwise the status of the other array is taken.
+   *
+   * @exception UB if the arrays are of different sizes
+   */
+  void Merge(const StatusArray& other) noexcept {
+    VOE_CONTRACT_CHECK(size_ == other.size_, "Merge() called with arrays of different sizes");
+    for (size_t block = 0; block < words_.size(); block += kBlockWords) {
+      uint64_t* lhs = words_.data() + block;
+      const uint64_t* rhs = other.words_.data() + block;
+      for (size_t word = 0; word < detail_::kPlaneWords; ++word) {
+        uint64_t failed = 0;
+        for (size_t plane = 0; plane < kPlanes; ++plane) {
+          failed |= lhs[plane * detail_::kPlaneWords + word];
+        }
+        for (size_t plane = 0; plane < kPlanes; ++plane) {
+          lhs[plane * detail_::kPlaneWords + word] |=
+            rhs[plane * detail_::kPlaneWords + word] & ~failed;
+        }
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t BlockCount(size_t size) noexcept {
+    return (size + detail_::kPlaneBlockRows - 1) / detail_::kPlaneBlockRows;
+  }
+
+  template <typename ErrorType>
+  static constexpr size_t ErrorCode() noexcept {
+    return 1 + Traits::template PhysicalErrorIndex<ErrorType>();
+  }
+
+  static size_t Code(const value_type& status) noexcept {
+    return status.IsEmpty() ? 0 : 1 + status.PhysicalIndex();
+  }
+
+  static value_type FromCode(size_t code) noexcept {
+    if (code == 0) {
+      return value_type{};
+    }
+    return detail_::Dispatch<Traits::StoredCount, Traits::HotStoredCount>(
+        code - 1, [](auto physical_index) {
+          return detail_::InPlaceFactory::Make<value_type, physical_index>();
+        });
+  }
+
+  size_t GetCode(size_t row) const noexcept {
+    const uint64_t* words = words_.data() + WordOffset(row);
+    size_t code = 0;
+    for (size_t plane = 0; plane < kPlanes; ++plane) {
+      code |= ((words[plane * detail_::kPlaneWords] >> (row % 64)) & 1) << plane;
+    }
+    return code;
+  }
+
+  void SetCode(size_t row, size_t code) noexcept {
+    uint64_t* words = words_.data() + WordOffset(row);
+    const uint64_t bit = uint64_t{1} << (row % 64);
+    for (size_t plane = 0; plane < kPlanes; ++plane) {
+      uint64_t& word = words[plane * detail_::kPlaneWords];
+      word = (word & ~bit) | ((uint64_t{0} - ((code >> plane) & 1)) & bit);
+    }
+  }
+
+  // The offset of the word of the first plane holding the bit of the row
+  static constexpr size_t WordOffset(size_t row) noexcept {
+    return row / detail_::kPlaneBlockRows * kBlockWords + row % detail_::kPlaneBlockRows / 64;
+  }
+
+  size_t Count(size_t code) const noexcept {
+    return detail_::GetPlaneKernels().count(
+        words_.data(), BlockCount(size_), kPlanes, code);
+  }
+
+  size_t Find(size_t code) const noexcept {
+    return std::min(
+        size_, detail_::GetPlaneKernels().find(words_.data(), BlockCount(size_), kPlanes, code));
+  }
+
+  std::vector<uint64_t> words_;
+  size_t size_{0};
+};
+
+}  // namespace voe
+
+#endif  // VOE_STATUS_ARRAY_HEADER
@@ -0,0 +1,536 @@
+#ifndef VOE_VECTOR_HEADER
+#define VOE_VECTOR_HEADER
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "voe/core.h"
+#include "voe/kernels.h"
+#include "voe/ref.h"
+
+namespace voe {
+
+namespace detail_ {
+
+// A minimal vector of plain bools. std::vector<bool> is bit-packed, so its elements can neither
+// be referenced by ValueOrErrorRef nor viewed as a span
+class BoolArray {
+ public:
+  using value_type = bool;
+
+  BoolArray() = default;
+  BoolArray(const BoolArray& other) { *this = other; }
+  BoolArray(BoolArray&& other) noexcept { *this = std::move(other); }
+
+  BoolArray& operator=(const BoolArray& other) {
+    if (this != &other) {
+      clear();
+      reserve(other.size_);
+      std::copy_n(other.data_.get(), other.size_, data_.get());
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  BoolArray& operator=(BoolArray&& other) noexcept {
+    data_ = std::move(other.data_);
+    size_ = std::exchange(other.size_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    return *this;
+  }
+
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  bool* data() noexcept { return data_.get(); }
+  const bool* data() const noexcept { return data_.get(); }
+  bool* begin() noexcept { return data_.get(); }
+  const bool* begin() const noexcept { return data_.get(); }
+  bool* end() noexcept { return data_.get() + size_; }
+  const bool* end() const noexcept { return data_.get() + size_; }
+
+  bool& operator[](size_t index) noexcept { return data_[index]; }
+  const bool& operator[](size_t index) const noexcept { return data_[index]; }
+  bool& back() noexcept { return data_[size_ - 1]; }
+
+  void reserve(size_t capacity) {
+    if (capacity > capacity_) {
+      auto grown = std::make_unique_for_overwrite<bool[]>(capacity);
+      std::copy_n(data_.get(), size_, grown.get());
+      data_ = std::move(grown);
+      capacity_ = capacity;
+    }
+  }
+
+  void clear() noexcept { size_ = 0; }
+
+  template <typename... Args>
+  bool& emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      reserve(std::max<size_t>(2 * capacity_, 8));
+    }
+    data_[size_] = bool(std::forward<Args>(args)...);
+    return data_[size_++];
+  }
+
+  void pop_back() noexcept { --size_; }
+
+ private:
+  std::unique_ptr<bool[]> data_;
+  size_t size_{0};
+  size_t capacity_{0};
+};
+
+template <typename Type>
+struct SideArrayHolder { using type = std::vector<Type>; };
+
+template <>
+struct SideArrayHolder<bool> { using type = BoolArray; };
+
+template <typename Type>
+using SideArray = typename SideArrayHolder<Type>::type;
+
+template <typename ValueType, typename... ErrorTypes>
+struct SideArraysHolder {
+  using type = std::tuple<SideArray<ValueType>, SideArray<ErrorTypes>...>;
+};
+
+template <typename... ErrorTypes>
+struct SideArraysHolder<void, ErrorTypes...> {
+  using type = std::tuple<SideArray<ErrorTypes>...>;
+};
+
+// One array per stored alternative, indexed by the physical index
+template <typename ValueType, typename... ErrorTypes>
+using SideArrays = typename SideArraysHolder<ValueType, ErrorTypes...>::type;
+
+template <typename Result>
+inline constexpr size_t LogicalIndexCount = Result::StoredCount + (Result::NeverEmpty ? 0 : 1);
+
+template <typename Result>
+constexpr bool IsLogicalEmptyIndex(size_t index) noexcept {
+  if constexpr (Result::NeverEmpty) {
+    return false;
+  } else {
+    return index == Result::LogicalEmptyIndex();
+  }
+}
+
+// The alternative can not be held by the destination: a value converted to void,
+// or an empty object converted to a never empty one
+inline constexpr size_t kUnmappedIndex = size_t(-1);
+
+/**
+ * @return the logical index of To for each of the logical indices of From, see IndexMapping
+ */
+template <typename To, typename From>
+constexpr auto LogicalIndexMapping() noexcept {
+  using PhysicalIndexMapping =
+    typename IndexMapping<typename From::StoredTypes>::template MapTo<typename To::StoredTypes>;
+
+  std::array<size_t, LogicalIndexCount<From>> mapping{};
+  for (size_t index = 0; index < mapping.size(); ++index) {
+    if (IsLogicalEmptyIndex<From>(index)) {
+      if constexpr (To::NeverEmpty) {
+        mapping[index] = kUnmappedIndex;
+      } else {
+        mapping[index] = To::LogicalEmptyIndex();
+      }
+    } else {
+      const size_t to_physical_index =
+        PhysicalIndexMapping::indices[From::LogicalToPhysicalIndex(index)];
+      mapping[index] = to_physical_index == size_t(-1)
+        ? kUnmappedIndex
+        : To::PhysicalToLogicalIndex(to_physical_index);
+    }
+  }
+  return mapping;
+}
+
+}  // namespace detail_
+
+/**
+ * @brief A sequence of ValueOrError<ValueType, ErrorTypes...> stored as a structure of arrays
+ *
+ * Instead of the array of ValueOrError objects, each sized for the largest alternative, the
+ * container keeps:
+ * - a dense array of the logical indices (see ValueOrError::LogicalIndex), one per element;
+ * - a dense array of the held values, in the order of the elements holding them (bool values
+ *   are stored as plain bools, not bit-packed as in std::vector<bool>);
+ * - an array per error type, holding only the errors of this type;
+ * - the position of each element's value or error in the respective array.
+ *
+ * Scanning the elements for errors only touches the indices array, and the rarely occurring
+ * large errors do not inflate the storage of the values. The elements are accessed through
+ * ValueOrErrorRef views, and the values and errors can be modified through Values() and
+ * Errors<ErrorType>() spans.
+ *
+ * The price is the index and the 4-byte position kept for every element, so the container only
+ * takes less memory than std::vector<ValueOrError<...>> if the largest error exceeds the value
+ * by more than that. E.g. an element holding an int value takes 1 + 4 + 4 = 9 bytes, against
+ * 40 bytes in the vector if the largest error is a std::string, but 8 bytes if it is an int.
+ *
+ * Unlike std::vector, elements can only be added and removed at the back.
+ */
+template <typename ValueType, typename... ErrorTypes>
+class ValueOrErrorVector {
+  using Traits = detail_::Traits<ValueType, ErrorTypes...>;
+  using Result = ValueOrError<ValueType, ErrorTypes...>;
+  using SlotType = uint32_t;
+
+ public:
+  using IndexType = std::remove_cvref_t<decltype(std::declval<const Traits&>().LogicalIndex())>;
+  using reference = ValueOrErrorRef<ValueType, ErrorTypes...>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(detail_::AllDecayed<ValueType, ErrorTypes...>, "All types must be decayed");
+  static_assert(detail_::AllUnique<ErrorTypes...>, "Error types must not contain duplicates");
+
+  /**
+   * @brief A random access iterator over the ValueOrErrorRef views of the elements
+   */
+  class Iterator {
+   public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = reference;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() noexcept = default;
+
+    reference operator*() const noexcept { return (*vector_)[position_]; }
+    reference operator[](difference_type offset) const noexcept {
+      return (*vector_)[position_ + offset];
+    }
+
+    Iterator& operator++() noexcept { ++position_; return *this; }
+    Iterator operator++(int) noexcept { Iterator copy = *this; ++position_; return copy; }
+    Iterator& operator--() noexcept { --position_; return *this; }
+    Iterator operator--(int) noexcept { Iterator copy = *this; --position_; return copy; }
+
+    Iterator& operator+=(difference_type offset) noexcept { position_ += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { position_ -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return static_cast<difference_type>(lhs.position_ - rhs.position_);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.position_ == rhs.position_;
+    }
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept {
+      return lhs.position_ <=> rhs.position_;
+    }
+
+   private:
+    friend class ValueOrErrorVector;
+
+    Iterator(const ValueOrErrorVector* vector, size_t position) noexcept
+      : vector_(vector)
+      , position_(position)
+    {}
+
+    const ValueOrErrorVector* vector_{nullptr};
+    size_t position_{0};
+  };
+
+  ValueOrErrorVector() = default;
+
+  /**
+   * @brief ValueOrErrorVector conversion constructor
+   *
+   * Converts the elements the same way as the ValueOrError conversion constructor does, but
+   * without visiting them one by one: the logical indices are remapped with a byte shuffle
+   * (see VOE_BATCH_SIMD), the positions are copied, and the values and errors are copied array
+   * by array.
+   *
+   * @exception (UB) from holds a value, and this type's ValueType is void
+   * @exception (UB) from holds an empty element, and this type is never empty
+   */
+  template <typename FromValueType, typename... FromErrorTypes>
+    requires std::is_constructible_v<
+      ValueOrError<ValueType, ErrorTypes...>, const ValueOrError<FromValueType, FromErrorTypes...>&>
+  explicit ValueOrErrorVector(const ValueOrErrorVector<FromValueType, FromErrorTypes...>& from) {
+    ConvertFrom(from);
+  }
+
+  /**
+   * @brief ValueOrErrorVector conversion constructor
+   * @see the above one, this one moves the values and errors arrays
+   */
+  template <typename FromValueType, typename... FromErrorTypes>
+    requires std::is_constructible_v<
+      ValueOrError<ValueType, ErrorTypes...>, ValueOrError<FromValueType, FromErrorTypes...>&&>
+  explicit ValueOrErrorVector(ValueOrErrorVector<FromValueType, FromErrorTypes...>&& from) {
+    ConvertFrom(std::move(from));
+  }
+
+  size_t size() const noexcept { return indices_.size(); }
+  bool empty() const noexcept { return indices_.empty(); }
+
+  /**
+   * @brief Reserves the storage for the specified number of elements
+   *
+   * The values array is reserved as well, the errors are expected to be rare.
+   */
+  void reserve(size_t capacity) {
+    indices_.reserve(capacity);
+    slots_.reserve(capacity);
+    if constexpr (!std::is_void_v<ValueType>) {
+      std::get<0>(arrays_).reserve(capacity);
+    }
+  }
+
+  /**
+   * @brief Destroys all the elements
+   */
+  void clear() noexcept {
+    indices_.clear();
+    slots_.clear();
+    std::apply([](auto&... arrays) { (..., arrays.clear()); }, arrays_);
+  }
+
+  /**
+   * @brief Appends the element holding the same value or error as from
+   *
+   * Accepts every ValueOrError that is convertible to ValueOrError<ValueType, ErrorTypes...>,
+   * the held value or error is copied or moved directly to its array.
+   *
+   * @exception (UB) from holds a value, and this type's ValueType is void
+   * @exception (UB) from is empty, and this type is never empty, see NeverEmptyTraits
+   * @exception Any exception thrown from copy or move constructor of respective type
+   */
+  template <typename FromVoe>
+    requires detail_::IsValueOrError<FromVoe>
+          && std::is_constructible_v<ValueOrError<ValueType, ErrorTypes...>, FromVoe&&>
+  void push_back(FromVoe&& from) {
+    using FromType = std::remove_cvref_t<FromVoe>;
+    if (from.IsEmpty()) {
+      if constexpr (Traits::NeverEmpty) {
+        VOE_CONTRACT_CHECK(
+            !Traits::NeverEmpty, "push_back() of an empty object to a vector of never empty ones");
+      } else {
+        Reserve();
+        Append(Traits::LogicalEmptyIndex(), 0);
+      }
+      return;
+    }
+    using PhysicalIndexMapping =
+      typename detail_::IndexMapping<typename FromType::StoredTypes>
+      ::template MapTo<typename Traits::StoredTypes>;
+
+    detail_::Dispatch<FromType::StoredCount, FromType::HotStoredCount>(
+        from.PhysicalIndex(), [this, &from](auto index) {
+          constexpr size_t this_phys_index = PhysicalIndexMapping::indices[index];
+          if constexpr (this_phys_index == size_t(-1)) {
+            VOE_CONTRACT_CHECK(
+                this_phys_index != size_t(-1),
+                "ValueOrErrorVector<void, ...> is trying to store a value");
+          } else {
+            EmplaceStored<this_phys_index>(
+                detail_::ForwardLike<FromVoe>(detail_::Get<index>(from.Data())));
+          }
+        });
+  }
+
+  /**
+   * @brief Appends the element holding a value constructed from the specified arguments
+   */
+  template <typename... Args>
+    requires (!std::is_void_v<ValueType>) && std::is_constructible_v<ValueType, Args&&...>
+  auto& emplace_back(Args&&... args) {
+    EmplaceStored<0>(std::forward<Args>(args)...);
+    return std::get<0>(arrays_).back();
+  }
+
+  /**
+   * @brief Appends the element holding an error constructed from the specified arguments
+   */
+  template <typename ErrorType, typename... Args>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  ErrorType& EmplaceBackError(Args&&... args) {
+    constexpr size_t physical_index = Traits::template PhysicalErrorIndex<ErrorType>();
+    EmplaceStored<physical_index>(std::forward<Args>(args)...);
+    return std::get<physical_index>(arrays_).back();
+  }
+
+  /**
+   * @brief Appends the element holding the specified error
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<std::decay_t<ErrorType>, ErrorTypes...>
+  void PushBackError(ErrorType&& error) {
+    EmplaceBackError<std::decay_t<ErrorType>>(std::forward<ErrorType>(error));
+  }
+
+  /**
+   * @brief Removes the last element
+   * @exception UB if empty()
+   */
+  void pop_back() noexcept {
+    VOE_CONTRACT_CHECK(!empty(), "pop_back() called on an empty ValueOrErrorVector");
+    const size_t index = indices_.back();
+    if (!IsEmptyIndex(index)) {
+      // The last element's value or error is always the last one in its array
+      detail_::Dispatch<Traits::StoredCount, Traits::HotStoredCount>(
+          Traits::LogicalToPhysicalIndex(index), [this](auto physical_index) {
+            std::get<physical_index>(arrays_).pop_back();
+          });
+    }
+    indices_.pop_back();
+    slots_.pop_back();
+  }
+
+  /**
+   * @return a view of the element at the specified position
+   * @exception UB if position >= size()
+   */
+  reference operator[](size_t position) const noexcept {
+    VOE_CONTRACT_CHECK(position < size(), "ValueOrErrorVector position is out of range");
+    const IndexType index = indices_[position];
+    if (IsEmptyIndex(index)) {
+      return reference(detail_::StorageRefTag{}, nullptr, index);
+    }
+    const SlotType slot = slots_[position];
+    const void* data = detail_::Dispatch<Traits::StoredCount, Traits::HotStoredCount>(
+        Traits::LogicalToPhysicalIndex(index), [this, slot](auto physical_index) -> const void* {
+          return &std::get<physical_index>(arrays_)[slot];
+        });
+    return reference(detail_::StorageRefTag{}, data, index);
+  }
+
+  Iterator begin() const noexcept { return Iterator(this, 0); }
+  Iterator end() const noexcept { return Iterator(this, size()); }
+
+  /**
+   * @return the logical indices of the elements, see ValueOrError::LogicalIndex
+   */
+  std::span<const IndexType> Indices() const noexcept { return indices_; }
+
+  /**
+   * @return the values held by the elements, in the order of the elements
+   */
+  auto Values() noexcept requires (!std::is_void_v<ValueType>) {
+    return std::span(std::get<0>(arrays_));
+  }
+  auto Values() const noexcept requires (!std::is_void_v<ValueType>) {
+    return std::span(std::get<0>(arrays_));
+  }
+
+  /**
+   * @return the errors of the specified type held by the elements, in the order of the elements
+   */
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  std::span<ErrorType> Errors() noexcept {
+    return std::get<Traits::template PhysicalErrorIndex<ErrorType>()>(arrays_);
+  }
+  template <typename ErrorType>
+    requires detail_::TypesContain<ErrorType, ErrorTypes...>
+  std::span<const ErrorType> Errors() const noexcept {
+    return std::get<Traits::template PhysicalErrorIndex<ErrorType>()>(arrays_);
+  }
+
+ private:
+  template <typename, typename...>
+  friend class ValueOrErrorVector;
+
+  static constexpr bool IsEmptyIndex(size_t index) noexcept {
+    if constexpr (Traits::NeverEmpty) {
+      return false;
+    } else {
+      return index == Traits::LogicalEmptyIndex();
+    }
+  }
+
+  // Grows the dense arrays beforehand, so that appending to them after the value or the error
+  // is constructed does not throw
+  void Reserve() {
+    if (indices_.size() == indices_.capacity() || slots_.size() == slots_.capacity()) {
+      const size_t capacity = std::max<size_t>(2 * size(), 8);
+      indices_.reserve(capacity);
+      slots_.reserve(capacity);
+    }
+  }
+
+  void Append(size_t index, size_t slot) noexcept {
+    indices_.push_back(static_cast<IndexType>(index));
+    slots_.push_back(static_cast<SlotType>(slot));
+  }
+
+  template <size_t PhysicalIndex, typename... Args>
+  void EmplaceStored(Args&&... args) {
+    auto& array = std::get<PhysicalIndex>(arrays_);
+    VOE_CONTRACT_CHECK(
+        array.size() < std::numeric_limits<SlotType>::max(),
+        "ValueOrErrorVector can not hold that many values or errors of the same type");
+    Reserve();
+    array.emplace_back(std::forward<Args>(args)...);
+    Append(Traits::PhysicalToLogicalIndex(PhysicalIndex), array.size() - 1);
+  }
+
+  template <typename FromVector>
+  void ConvertFrom(FromVector&& from) {
+    using FromResult = typename std::remove_cvref_t<FromVector>::Result;
+    using FromKernels = detail_::IndexKernels<typename std::remove_cvref_t<FromVector>::IndexType>;
+    if constexpr (!std::is_void_v<typename FromResult::value_type> && std::is_void_v<ValueType>) {
+      VOE_CONTRACT_CHECK(
+          from.Values().empty(), "ValueOrErrorVector<void, ...> is trying to store a value");
+    }
+    if constexpr (Traits::NeverEmpty && !FromResult::NeverEmpty) {
+      VOE_CONTRACT_CHECK(
+          FromKernels::CountEqual(
+              from.indices_.data(), from.size(), FromResult::LogicalEmptyIndex()) == 0,
+          "Conversion of a vector with empty objects to a vector of never empty ones");
+    }
+
+    static constexpr auto mapping = detail_::LogicalIndexMapping<Result, FromResult>();
+    indices_.resize(from.size());
+    FromKernels::Remap(from.indices_.data(), from.size(), mapping, indices_.data());
+    slots_ = detail_::ForwardLike<FromVector>(from.slots_);
+
+    using PhysicalIndexMapping =
+      typename detail_::IndexMapping<typename FromResult::StoredTypes>
+      ::template MapTo<typename Traits::StoredTypes>;
+    [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+      (..., [&] {
+        constexpr size_t this_phys_index = PhysicalIndexMapping::indices[Indices];
+        if constexpr (this_phys_index != size_t(-1)) {
+          std::get<this_phys_index>(arrays_) =
+            detail_::ForwardLike<FromVector>(std::get<Indices>(from.arrays_));
+        }
+      }());
+    }(std::make_index_sequence<FromResult::StoredCount>{});
+    if constexpr (!std::is_lvalue_reference_v<FromVector>) {
+      // The arrays of from are moved out, so its elements are gone as well
+      from.clear();
+    }
+  }
+
+  std::vector<IndexType> indices_;
+  std::vector<SlotType> slots_;
+  detail_::SideArrays<ValueType, ErrorTypes...> arrays_;
+};
+
+/**
+ * @brief A shorter type template alias for vectors of void-returning functions' results
+ */
+template <typename... ErrorTypes>
+using VoidOrErrorVector = ValueOrErrorVector<void, ErrorTypes...>;
+
+}  // namespace voe
+
+#endif  // VOE_VECTOR_HEADER
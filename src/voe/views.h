@@ -0,0 +1,136 @@
+#ifndef VOE_VIEWS_HEADER
+#define VOE_VIEWS_HEADER
+
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include "voe/core.h"
+
+namespace voe {
+
+namespace detail_ {
+
+template <typename Result>
+struct CollectedHolder;
+
+template <typename ValueType, typename... ErrorTypes>
+struct CollectedHolder<ValueOrError<ValueType, ErrorTypes...>> {
+  using type = ValueOrError<std::vector<ValueType>, ErrorTypes...>;
+};
+
+template <typename Result>
+using Collected = typename CollectedHolder<std::remove_cvref_t<Result>>::type;
+
+/**
+ * @return the held value of the result, by reference if the result is an lvalue, and by value
+ * otherwise, as the rvalue results of the views are temporaries
+ */
+struct GetViewedValue {
+  template <typename Result>
+  constexpr decltype(auto) operator()(Result&& result) const {
+    if constexpr (std::is_lvalue_reference_v<Result>) {
+      return result.GetValue();
+    } else {
+      return std::remove_cvref_t<decltype(result.GetValue())>(std::move(result).GetValue());
+    }
+  }
+};
+
+/**
+ * @return the held error of the result, as GetViewedValue does
+ */
+template <typename ErrorType>
+struct GetViewedError {
+  template <typename Result>
+  constexpr decltype(auto) operator()(Result&& result) const {
+    if constexpr (std::is_lvalue_reference_v<Result>) {
+      return result.template GetError<ErrorType>();
+    } else {
+      return ErrorType(std::move(result).template GetError<ErrorType>());
+    }
+  }
+};
+
+struct HasViewedValue {
+  template <typename Result>
+  constexpr bool operator()(const Result& result) const noexcept { return result.HasValue(); }
+};
+
+template <typename ErrorType>
+struct HasViewedError {
+  template <typename Result>
+  constexpr bool operator()(const Result& result) const noexcept {
+    return result.template HasError<ErrorType>();
+  }
+};
+
+}  // namespace detail_
+
+namespace views {
+
+// The range adaptors over the ranges of ValueOrError objects, e.g. results | voe::views::values.
+// The values and errors of the lvalue results are passed by reference, so they can be modified
+// through the views, while the ones of the prvalue results (e.g. produced by a transform view)
+// are moved out of them.
+
+/**
+ * @brief Lazily yields the held values, skipping the results not holding a value
+ */
+inline constexpr auto values =
+  std::views::filter(detail_::HasViewedValue{}) | std::views::transform(detail_::GetViewedValue{});
+
+/**
+ * @brief Lazily yields the held errors of the ErrorType, skipping the other results
+ */
+template <typename ErrorType>
+inline constexpr auto errors =
+  std::views::filter(detail_::HasViewedError<ErrorType>{})
+  | std::views::transform(detail_::GetViewedError<ErrorType>{});
+
+/**
+ * @brief Lazily yields the held values, up to the first result not holding a value
+ */
+inline constexpr auto ok_or_stop =
+  std::views::take_while(detail_::HasViewedValue{})
+  | std::views::transform(detail_::GetViewedValue{});
+
+}  // namespace views
+
+/**
+ * @brief Collects the values of the results into a vector
+ *
+ * Stops on the first result not holding a value, and returns its error (or an empty object) as
+ * ValueOrError<std::vector<ValueType>, ErrorTypes...>. Otherwise returns all the values, in the
+ * order of the results. The vector is reserved up front if the size of the range is known. The
+ * values and errors are moved out of the rvalue ranges owning them and the prvalue results, and
+ * copied otherwise.
+ */
+template <std::ranges::input_range Results>
+  requires detail_::IsValueOrError<std::ranges::range_value_t<Results>>
+        && (!std::is_void_v<typename std::ranges::range_value_t<Results>::value_type>)
+detail_::Collected<std::ranges::range_value_t<Results>> Collect(Results&& results) {
+  using Result = detail_::Collected<std::ranges::range_value_t<Results>>;
+  using Reference = std::ranges::range_reference_t<Results>;
+  using Element = std::conditional_t<
+      !std::is_lvalue_reference_v<Reference>
+        || (std::is_rvalue_reference_v<Results&&> && !std::ranges::borrowed_range<Results>),
+      std::remove_cvref_t<Reference>&&,
+      Reference>;
+
+  typename Result::value_type values;
+  if constexpr (std::ranges::sized_range<Results>) {
+    values.reserve(std::ranges::size(results));
+  }
+  for (auto&& result : results) {
+    if (!result.HasValue()) {
+      return Result(detail_::UncheckedConvertTag{}, detail_::ForwardLike<Element>(result));
+    }
+    values.push_back(detail_::ForwardLike<Element>(result).GetValue());
+  }
+  return Result(std::move(values));
+}
+
+}  // namespace voe
+
+#endif  // VOE_VIEWS_HEADER
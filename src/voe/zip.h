@@ -0,0 +1,65 @@
+#ifndef VOE_ZIP_HEADER
+#define VOE_ZIP_HEADER
+
+#include <tuple>
+#include <type_traits>
+
+#include "voe/core.h"
+
+namespace voe {
+
+namespace detail_ {
+
+template <typename... Results>
+using Zipped = voe::Union<
+  std::tuple<typename std::remove_cvref_t<Results>::value_type...>,
+  std::remove_cvref_t<Results>...>;
+
+// The first of the results not holding a value, converted to the zipped result
+template <typename Result, typename Head, typename... Tail>
+[[gnu::cold, gnu::noinline]] constexpr Result ZipFirstError(Head&& head, Tail&&... tail) {
+  if constexpr (sizeof...(Tail) != 0) {
+    if (head.HasValue()) {
+      return ZipFirstError<Result>(std::forward<Tail>(tail)...);
+    }
+  }
+  return Result(UncheckedConvertTag{}, std::forward<Head>(head));
+}
+
+}  // namespace detail_
+
+/**
+ * @brief Joins the values of several results into a tuple
+ *
+ * Returns ValueOrError<std::tuple<ValueTypes...>, Union of the ErrorTypes...>, holding either
+ * all of the values or the error of the first result not holding a value (or an empty object if
+ * it is empty). For example:
+ * @code
+ * ValueOrError<User, NotFound> user = FetchUser(id);
+ * ValueOrError<Cart, NotFound, Timeout> cart = FetchCart(id);
+ * ValueOrError<std::tuple<User, Cart>, NotFound, Timeout> joined =
+ *   Zip(std::move(user), std::move(cart));
+ * @endcode
+ *
+ * The discriminants of all the results are checked with a single compare, and the values are
+ * moved (or copied from the lvalue results) directly into the tuple held by the result.
+ */
+template <typename... Results>
+  requires (sizeof...(Results) != 0)
+        && (... && detail_::IsValueOrError<Results>)
+        && (... && !std::is_void_v<typename std::remove_cvref_t<Results>::value_type>)
+constexpr detail_::Zipped<Results...> Zip(Results&&... results) {
+  using Result = detail_::Zipped<Results...>;
+  const bool all_values =
+    (... | (static_cast<size_t>(results.LogicalIndex())
+            ^ std::remove_cvref_t<Results>::LogicalValueIndex())) == 0;
+  if (all_values) [[likely]] {
+    return detail_::InPlaceFactory::Make<Result, 0>(
+        detail_::ForwardLike<Results>(results.GetValue())...);
+  }
+  return detail_::ZipFirstError<Result>(std::forward<Results>(results)...);
+}
+
+}  // namespace voe
+
+#endif  // VOE_ZIP_HEADER
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+
+#include "value_or_error.h"
+
+// Built once per VOE_CONTRACT_MODE, see test/CMakeLists.txt
+
+namespace voe {
+
+namespace {
+
+struct Checked {
+  int value;
+
+  constexpr int Get() const {
+    VOE_CONTRACT_CHECK(value > 0, "value must be positive");
+    return value;
+  }
+
+  constexpr int Twice() const {
+    return VOE_CONTRACT_CHECK(value > 0, "value must be positive"), value * 2;
+  }
+};
+
+}  // namespace
+
+TEST(ContractTest, Constexpr) {
+  static_assert(Checked{1}.Get() == 1);
+  static_assert(Checked{1}.Twice() == 2);
+  static_assert(ValueOrError<int, char>(2).GetValue() == 2);
+  static_assert(MakeError<char>('a').GetError<char>() == 'a');
+}
+
+#if VOE_CONTRACT_MODE == VOE_CONTRACT_ASSERT && !defined(NDEBUG)
+
+TEST(ContractDeathTest, Assert) {
+  EXPECT_DEATH((void)Checked{0}.Get(), "value must be positive");
+}
+
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_ABORT
+
+TEST(ContractDeathTest, Abort) {
+  EXPECT_DEATH((void)Checked{0}.Get(), "Contract 'value > 0' violated: value must be positive");
+  EXPECT_DEATH(
+      ((void)ValueOrError<int, char>().GetValue()),
+      "Contract 'HasValue\\(\\)' violated: GetValue\\(\\) called on object with no value");
+}
+
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_TRAP
+
+TEST(ContractDeathTest, Trap) {
+  EXPECT_DEATH((void)Checked{0}.Get(), "");
+}
+
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_LOG
+
+TEST(ContractTest, Log) {
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(0, Checked{0}.Get());
+  const std::string output = testing::internal::GetCapturedStderr();
+  EXPECT_NE(
+      std::string::npos,
+      output.find("Contract 'value > 0' violated: value must be positive\n"))
+    << output;
+}
+
+#elif VOE_CONTRACT_MODE == VOE_CONTRACT_ASSUME
+
+template <int Value>
+concept ConstantGet = requires { typename std::integral_constant<int, Checked{Value}.Get()>; };
+
+TEST(ContractTest, Assume) {
+  EXPECT_EQ(1, Checked{1}.Get());
+  EXPECT_EQ(2, Checked{1}.Twice());
+
+  // A violated assumption is not a constant expression (Clang ignores it while evaluating one)
+  static_assert(ConstantGet<1>);
+#if !defined(__clang__)
+  static_assert(!ConstantGet<0>);
+#endif
+}
+
+#endif
+
+}  // namespace voe
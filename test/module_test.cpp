@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "voe/macros.h"
+
+import voe;
+
+// Built only with VOE_BUILD_MODULE, see test/CMakeLists.txt. Checks that the names used by
+// the clients are exported, and that the macros work next to the imported module.
+
+namespace {
+
+struct NotFound { int code; };
+struct Timeout { int code; };
+
+voe::ValueOrError<int, NotFound> Find(int key) {
+  if (key < 0) {
+    return voe::MakeError<NotFound>(key);
+  }
+  return key * 2;
+}
+
+voe::ValueOrError<int, NotFound, Timeout> FindTwice(int key) {
+  int found = 0;
+  ASSIGN_OR_RETURN_ERROR(found, Find(key));
+  ASSIGN_OR_RETURN_ERROR(found, Find(found));
+  return found;
+}
+
+voe::VoidOrError<NotFound, Timeout> Check(int key) {
+  RETURN_IF_ERROR(Find(key));
+  return {};
+}
+
+}  // namespace
+
+TEST(ModuleTest, Core) {
+  EXPECT_EQ(4, FindTwice(1).GetValue());
+  EXPECT_EQ(-1, FindTwice(-1).GetError<NotFound>().code);
+  EXPECT_FALSE(Check(1).HasAnyError());
+  EXPECT_TRUE(Check(-1).HasError<NotFound>());
+
+  static_assert(std::is_same_v<
+    voe::Union<int, voe::ValueOrError<int, NotFound>, voe::VoidOrError<Timeout>>,
+    voe::ValueOrError<int, NotFound, Timeout>>);
+}
+
+TEST(ModuleTest, Combinators) {
+  const auto pipeline = voe::Pipe(Find, Find);
+  EXPECT_EQ(8, pipeline(2).GetValue());
+  EXPECT_TRUE(pipeline(-2).HasError<NotFound>());
+
+  const auto zipped = voe::Zip(Find(1), Find(2));
+  EXPECT_EQ(std::make_tuple(2, 4), zipped.GetValue());
+}
+
+TEST(ModuleTest, Containers) {
+  std::vector<voe::ValueOrError<int, NotFound>> results{Find(1), Find(-1), Find(3)};
+  EXPECT_EQ(1u, voe::CountErrors(results));
+
+  auto errors = voe::CollectErrors(Find(-1), Find(1), Find(-2));
+  EXPECT_EQ(2u, errors.size());
+
+  int sum = 0;
+  for (int value : results | voe::views::values) {
+    sum += value;
+  }
+  EXPECT_EQ(8, sum);
+}
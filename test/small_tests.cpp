@@ -1,6 +1,24 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "value_or_error.h"
+#include "voe/batch.h"
+#include "voe/error_list.h"
+#include "voe/parallel.h"
+#include "voe/status_array.h"
+#include "voe/vector.h"
+#include "voe/views.h"
+#include "voe/zip.h"
+#include "tools.h"
 
 namespace voe {
 
@@ -238,4 +256,1194 @@ TEST(ValueOrErrorTest, ErrorPermutation) {
   EXPECT_STREQ(val.GetError<const char*>(), "some error");
 }
 
+size_t ViewedErrorIndex(ValueOrErrorRef<int, bool, char, short> ref) {
+  return ref.GetErrorIndex();
+}
+
+TEST(ValueOrErrorRefTest, Value) {
+  ValueOrError<int, char> voe{10};
+  ValueOrErrorRef<int, short, char> ref{voe};
+  EXPECT_FALSE(ref.IsEmpty());
+  EXPECT_TRUE(ref.HasValue());
+  EXPECT_FALSE(ref.HasAnyError());
+  EXPECT_EQ(&voe.GetValue(), &ref.GetValue());
+  EXPECT_EQ(10, ref.Visit([](auto& x) { return static_cast<int>(x); }));
+}
+
+TEST(ValueOrErrorRefTest, Empty) {
+  ValueOrError<int, char> voe;
+  ValueOrErrorRef<int, short, char> ref{voe};
+  EXPECT_TRUE(ref.IsEmpty());
+  EXPECT_FALSE(ref.HasValue());
+  EXPECT_FALSE(ref.HasAnyError());
+}
+
+TEST(ValueOrErrorRefTest, RemappedError) {
+  ValueOrError<int, short, char> voe{MakeError<char>('a')};
+  ValueOrErrorRef<int, bool, char, short> ref{voe};
+  EXPECT_FALSE(ref.IsEmpty());
+  EXPECT_FALSE(ref.HasValue());
+  EXPECT_TRUE(ref.HasAnyError());
+  EXPECT_TRUE(ref.HasError<char>());
+  EXPECT_FALSE(ref.HasError<short>());
+  EXPECT_EQ(1U, ref.GetErrorIndex());
+  EXPECT_EQ(&voe.GetError<char>(), &ref.GetError<char>());
+  EXPECT_EQ('a', ref.GetError<1>());
+  EXPECT_EQ(1U, ViewedErrorIndex(voe));
+  EXPECT_EQ(2U, ViewedErrorIndex(ValueOrError<int, short>{MakeError<short>(1)}));
+}
+
+TEST(ValueOrErrorRefTest, Void) {
+  VoidOrError<char> ok;
+  VoidOrErrorRef<short, char> ok_ref{ok};
+  EXPECT_FALSE(ok_ref.HasAnyError());
+  EXPECT_EQ(0, ok_ref.Visit([](auto&&... x) { return static_cast<int>(sizeof...(x)); }));
+
+  ValueOrError<int, char> err{MakeError<char>('a')};
+  VoidOrErrorRef<short, char> err_ref{err};
+  EXPECT_TRUE(err_ref.HasError<char>());
+  EXPECT_EQ(1, err_ref.Visit([](auto&&... x) { return static_cast<int>(sizeof...(x)); }));
+}
+
+TEST(ValueOrErrorRefDeathTest, ValueIsViewedAsVoid) {
+  ValueOrError<int, char> from{10};
+  EXPECT_DEATH(((void)VoidOrErrorRef<char>(from)), "trying to view a value");
+}
+
+TEST(CanonicalTest, SameSetIsSameType) {
+  using A = CanonicalUnion<int, ValueOrError<int, char>, short>;
+  using B = CanonicalUnion<int, short, VoidOrError<char>>;
+  static_assert(std::is_same_v<A, B>);
+
+  A from{MakeError<short>(short{3})};
+  B voe = from;
+  EXPECT_TRUE(voe.HasError<short>());
+  EXPECT_EQ(3, voe.GetError<short>());
+  EXPECT_EQ(from.GetErrorIndex(), voe.GetErrorIndex());
+}
+
+struct Retryable {};
+struct Timeout { using ErrorCategory = Retryable; };
+struct Unavailable { int code; };
+
+}  // namespace voe
+
+template <>
+struct voe::ErrorCategoryTraits<voe::Unavailable> { using type = voe::Retryable; };
+
+namespace voe {
+
+TEST(ErrorCategoryTest, HasAnyOf) {
+  ValueOrError<int, char, short, long> voe{MakeError<short>(short{1})};
+  EXPECT_TRUE((voe.HasAnyOf<char, short>()));
+  EXPECT_TRUE((voe.HasAnyOf<short, long>()));
+  EXPECT_TRUE((voe.HasAnyOf<char, long, short>()));
+  EXPECT_FALSE((voe.HasAnyOf<char, long>()));
+  EXPECT_FALSE(voe.HasAnyOf<>());
+
+  voe = 10;
+  EXPECT_FALSE((voe.HasAnyOf<char, short, long>()));
+}
+
+TEST(ErrorCategoryTest, HasErrorIn) {
+  using Result = Categorized<ValueOrError<int, Timeout, char, Unavailable>>;
+  static_assert(std::is_same_v<Result, ValueOrError<int, Timeout, Unavailable, char>>);
+
+  Result voe{MakeError<Unavailable>(Unavailable{503})};
+  EXPECT_TRUE(voe.HasErrorIn<Retryable>());
+  EXPECT_FALSE(voe.HasErrorIn<void>());
+
+  voe = MakeError<char>('a');
+  EXPECT_FALSE(voe.HasErrorIn<Retryable>());
+  EXPECT_TRUE(voe.HasErrorIn<void>());
+
+  voe = 10;
+  EXPECT_FALSE(voe.HasErrorIn<Retryable>());
+  EXPECT_FALSE(voe.HasErrorIn<void>());
+
+  ValueOrError<int, Timeout, char, Unavailable> scattered{MakeError<Unavailable>(Unavailable{})};
+  EXPECT_TRUE(scattered.HasErrorIn<Retryable>());
+  scattered = MakeError<char>('a');
+  EXPECT_FALSE(scattered.HasErrorIn<Retryable>());
+
+  VoidOrErrorRef<char, Timeout, Unavailable> ref = scattered;
+  EXPECT_TRUE(ref.HasErrorIn<void>());
+  EXPECT_FALSE((ref.HasAnyOf<Timeout, Unavailable>()));
+}
+
+ValueOrError<int, const char*> ParsePositive(int x) {
+  if (x <= 0) {
+    return MakeError<const char*>("not positive");
+  }
+  return x;
+}
+
+TEST(MonadicTest, Transform) {
+  auto doubled = ValueOrError<int, char>{21}.Transform([](int x) { return 2.0 * x; });
+  static_assert(std::is_same_v<decltype(doubled), ValueOrError<double, char>>);
+  EXPECT_EQ(42.0, doubled.GetValue());
+
+  const ValueOrError<int, char> error{MakeError<char>('a')};
+  auto transformed = error.Transform([](int) -> double { ADD_FAILURE(); return 0; });
+  EXPECT_EQ('a', transformed.GetError<char>());
+
+  auto empty = ValueOrError<int, char>{}.Transform([](int) { ADD_FAILURE(); return 0; });
+  EXPECT_TRUE(empty.IsEmpty());
+
+  auto discarded = ValueOrError<int, char>{1}.Transform([](int) {});
+  static_assert(std::is_same_v<decltype(discarded), VoidOrError<char>>);
+  EXPECT_FALSE(discarded.HasAnyError());
+
+  auto from_void = VoidOrError<char>{}.Transform([] { return 1; });
+  static_assert(std::is_same_v<decltype(from_void), ValueOrError<int, char>>);
+  EXPECT_EQ(1, from_void.GetValue());
+}
+
+TEST(MonadicTest, AndThen) {
+  auto ok = ValueOrError<int, char>{1}.AndThen(ParsePositive);
+  static_assert(std::is_same_v<decltype(ok), ValueOrError<int, char, const char*>>);
+  EXPECT_EQ(1, ok.GetValue());
+
+  auto failed = ValueOrError<int, char>{-1}.AndThen(ParsePositive);
+  EXPECT_STREQ("not positive", failed.GetError<const char*>());
+
+  auto propagated = ValueOrError<int, char>{MakeError<char>('a')}.AndThen(ParsePositive);
+  EXPECT_EQ('a', propagated.GetError<char>());
+
+  auto chained = ParsePositive(2)
+    .AndThen([](int x) { return ParsePositive(x - 2); })
+    .AndThen([](int) -> VoidOrError<short> { ADD_FAILURE(); return {}; });
+  static_assert(std::is_same_v<decltype(chained), VoidOrError<const char*, short>>);
+  EXPECT_TRUE(chained.HasError<const char*>());
+}
+
+TEST(MonadicTest, OrElse) {
+  auto recovered = ParsePositive(-1).OrElse([](const char*) -> ValueOrError<int, bool> {
+    return 0;
+  });
+  static_assert(std::is_same_v<decltype(recovered), ValueOrError<int, bool>>);
+  EXPECT_EQ(0, recovered.GetValue());
+
+  auto kept = ParsePositive(3).OrElse([](const char*) -> ValueOrError<int, bool> {
+    ADD_FAILURE();
+    return MakeError<bool>(false);
+  });
+  EXPECT_EQ(3, kept.GetValue());
+
+  auto translated = ValueOrError<int, char, short>{MakeError<short>(7)}.OrElse(
+      [](auto error) { return MakeError<long>(error); });
+  static_assert(std::is_same_v<decltype(translated), ValueOrError<int, long>>);
+  EXPECT_EQ(7, translated.GetError<long>());
+}
+
+TEST(MonadicTest, TransformError) {
+  auto translated = ValueOrError<int, char, short>{MakeError<char>('a')}.TransformError(
+      [](auto error) { return static_cast<long>(error); });
+  static_assert(std::is_same_v<decltype(translated), ValueOrError<int, long>>);
+  EXPECT_EQ('a', translated.GetError<long>());
+
+  auto value = ValueOrError<int, char>{1}.TransformError([](char) { return 1.f; });
+  static_assert(std::is_same_v<decltype(value), ValueOrError<int, float>>);
+  EXPECT_EQ(1, value.GetValue());
+
+  auto void_error = VoidOrError<char>{MakeError<char>('b')}.TransformError(
+      [](char c) { return std::string(1, c); });
+  EXPECT_EQ("b", void_error.GetError<std::string>());
+}
+
+TEST(PipelineTest, Value) {
+  int calls = 0;
+  auto pipeline = Pipe(
+      [&calls](int x) { ++calls; return x + 1; },
+      ParsePositive,
+      [&calls](int x) -> ValueOrError<double, char> { ++calls; return x / 2.0; });
+  EXPECT_EQ(0, calls);
+
+  auto result = pipeline(2);
+  static_assert(std::is_same_v<decltype(result), ValueOrError<double, const char*, char>>);
+  EXPECT_EQ(2, calls);
+  EXPECT_EQ(1.5, result.GetValue());
+}
+
+TEST(PipelineTest, StopsOnError) {
+  int calls = 0;
+  auto pipeline = Pipe(
+      ParsePositive,
+      [&calls](int) -> VoidOrError<char> { ++calls; return MakeError<char>('a'); },
+      [&calls]() { ++calls; return 1; });
+
+  auto error = pipeline(1);
+  static_assert(std::is_same_v<decltype(error), ValueOrError<int, const char*, char>>);
+  EXPECT_EQ(1, calls);
+  EXPECT_EQ('a', error.GetError<char>());
+
+  auto first_error = pipeline(-1);
+  EXPECT_EQ(1, calls);
+  EXPECT_STREQ("not positive", first_error.GetError<const char*>());
+}
+
+TEST(PipelineTest, Void) {
+  int sum = 0;
+  auto pipeline = Pipe(
+      [&sum] { sum += 1; },
+      [&sum]() -> VoidOrError<char> { sum += 2; return {}; });
+
+  auto result = pipeline();
+  static_assert(std::is_same_v<decltype(result), VoidOrError<char>>);
+  EXPECT_FALSE(result.HasAnyError());
+  EXPECT_EQ(3, sum);
+}
+
+TEST(PipelineTest, EmptyStepResult) {
+  auto result = Pipe([](int) { return ValueOrError<int, char>{}; }, ParsePositive)(1);
+  EXPECT_TRUE(result.IsEmpty());
+}
+
+TEST(FlattenTest, Correctness) {
+  using Nested = ValueOrError<ValueOrError<int, char>, short>;
+
+  auto value = Nested{ValueOrError<int, char>{1}}.Flatten();
+  static_assert(std::is_same_v<decltype(value), ValueOrError<int, char, short>>);
+  EXPECT_EQ(1, value.GetValue());
+
+  auto inner_error = Nested{ValueOrError<int, char>{MakeError<char>('a')}}.Flatten();
+  EXPECT_EQ('a', inner_error.GetError<char>());
+
+  const Nested outer_error_voe{MakeError<short>(2)};
+  auto outer_error = outer_error_voe.Flatten();
+  EXPECT_EQ(2, outer_error.GetError<short>());
+
+  EXPECT_TRUE(Nested{}.Flatten().IsEmpty());
+  EXPECT_TRUE((Nested{ValueOrError<int, char>{}}.Flatten().IsEmpty()));
+}
+
+TEST(FlattenTest, Combinators) {
+  auto transformed = ValueOrError<int, char>{1}.Transform(ParsePositive);
+  static_assert(std::is_same_v<decltype(transformed), ValueOrError<int, const char*, char>>);
+  EXPECT_EQ(1, transformed.GetValue());
+
+  using Nested = ValueOrError<ValueOrError<int, const char*>, short>;
+  auto nested =
+      ValueOrError<int, char>{-1}.AndThen([](int x) -> Nested { return ParsePositive(x); });
+  static_assert(std::is_same_v<decltype(nested), ValueOrError<int, const char*, char, short>>);
+  EXPECT_STREQ("not positive", nested.GetError<const char*>());
+
+  auto piped = Pipe(
+      [](int x) {
+        return ValueOrError<ValueOrError<int, char>, short>{ValueOrError<int, char>{x}};
+      },
+      [](int x) { return x + 1; })(1);
+  static_assert(std::is_same_v<decltype(piped), ValueOrError<int, char, short>>);
+  EXPECT_EQ(2, piped.GetValue());
+}
+
+struct ParseError { std::string message; };
+struct IoError { int code; };
+struct Status { std::string message; };
+struct Errno {
+  explicit Errno(IoError e) : code(e.code) {}
+  int code;
+};
+
+struct ToStatus {
+  static Status Translate(ParseError&& e) { return Status{"parse: " + e.message}; }
+  static Status Translate(const ParseError& e) { return Status{"parse: " + e.message}; }
+  static std::type_identity<Errno> Translate(IoError);
+};
+
+TEST(MapErrorsTest, Translate) {
+  using Source = ValueOrError<int, ParseError, IoError, char>;
+
+  auto parse = Source{MakeError<ParseError>("bad")}.MapErrors<ToStatus>();
+  static_assert(std::is_same_v<decltype(parse), ValueOrError<int, Status, Errno, char>>);
+  EXPECT_EQ("parse: bad", parse.GetError<Status>().message);
+
+  const Source io_voe{MakeError<IoError>(5)};
+  EXPECT_EQ(5, io_voe.MapErrors<ToStatus>().GetError<Errno>().code);
+
+  EXPECT_EQ('x', Source{MakeError<char>('x')}.MapErrors<ToStatus>().GetError<char>());
+  EXPECT_EQ(7, Source{7}.MapErrors<ToStatus>().GetValue());
+  EXPECT_TRUE(Source{}.MapErrors<ToStatus>().IsEmpty());
+}
+
+TEST(MapErrorsTest, ValueCategory) {
+  struct FromRvalue {
+    static Status Translate(ParseError&& e) { return Status{std::move(e.message)}; }
+  };
+
+  using Source = ValueOrError<int, ParseError>;
+  const Source copied{MakeError<ParseError>("bad")};
+  static_assert(std::is_same_v<decltype(copied.MapErrors<FromRvalue>()), Source>);
+  EXPECT_EQ("bad", copied.MapErrors<FromRvalue>().GetError<ParseError>().message);
+
+  auto moved = Source{MakeError<ParseError>("bad")}.MapErrors<FromRvalue>();
+  static_assert(std::is_same_v<decltype(moved), ValueOrError<int, Status>>);
+  EXPECT_EQ("bad", moved.GetError<Status>().message);
+}
+
+TEST(MapErrorsTest, MergesTargets) {
+  struct ToString {
+    static std::string Translate(const char* e) { return e; }
+    static std::string Translate(char e) { return std::string(1, e); }
+  };
+
+  auto merged = VoidOrError<const char*, char, std::string>{MakeError<char>('c')}
+    .MapErrors<ToString>();
+  static_assert(std::is_same_v<decltype(merged), VoidOrError<std::string>>);
+  EXPECT_EQ("c", merged.GetError<std::string>());
+
+  auto single = ValueOrError<int, char>{MakeError<char>('c')}.MapErrors<ToString>();
+  static_assert(std::is_same_v<decltype(single), ValueOrError<int, std::string>>);
+  EXPECT_EQ("c", single.GetError<std::string>());
+}
+
+struct Config { std::string name; };
+
+template <>
+struct NeverEmptyTraits<Config> : public std::true_type {};
+
+template <typename Voe>
+concept Clearable = requires(Voe& voe) { voe.Clear(); };
+
+TEST(NeverEmptyTest, Correctness) {
+  using Result = ValueOrError<Config, ParseError, IoError>;
+  static_assert(!std::is_default_constructible_v<Result>);
+  static_assert(!Clearable<Result> && Clearable<ValueOrError<int, IoError>>);
+  static_assert(Result::LogicalValueIndex() == 0 && Result::LogicalFirstErrorIndex() == 1);
+
+  const Result value{Config{"a"}};
+  const Result error{MakeError<IoError>(5)};
+  EXPECT_FALSE(value.IsEmpty());
+  EXPECT_EQ("a", value.GetValue().name);
+  EXPECT_EQ(5, error.GetError<IoError>().code);
+
+  Result copy = value;
+  copy = error;
+  EXPECT_EQ(5, copy.GetError<IoError>().code);
+  copy = value;
+  EXPECT_EQ("a", copy.GetValue().name);
+  copy.SetError(ParseError{"bad"});
+  EXPECT_EQ("bad", copy.GetError<ParseError>().message);
+
+  auto narrowed = std::move(copy).DiscardErrors<IoError>();
+  static_assert(std::is_same_v<decltype(narrowed), ValueOrError<Config, ParseError>>);
+  EXPECT_EQ("bad", narrowed.GetError<ParseError>().message);
+
+  EXPECT_EQ(5, error.MapErrors<ToStatus>().GetError<Errno>().code);
+  EXPECT_EQ(1u, error.Visit([](const auto& alternative) { return sizeof(alternative) > 0; }));
+}
+
+TEST(NeverEmptyDeathTest, EmptyIsRejected) {
+  EXPECT_DEATH(
+      ((void)ValueOrError<Config, IoError>(VoidOrError<IoError>{})),
+      "never empty object from an empty one");
+  EXPECT_DEATH(
+      ((void)ValueOrError<Config, IoError>(MakeError<IoError>(1)).DiscardErrors<IoError>()),
+      "removed the error held by a never empty object");
+}
+
+TEST(ValueOrErrorVectorTest, Correctness) {
+  ValueOrErrorVector<std::string, ParseError, IoError> results;
+  results.push_back(ValueOrError<std::string, IoError>{std::string("a")});
+  results.push_back(MakeError<IoError>(5));
+  results.push_back(ValueOrError<std::string, ParseError, IoError>{});
+  results.emplace_back("b");
+  results.EmplaceBackError<ParseError>("bad");
+  ASSERT_EQ(5u, results.size());
+
+  EXPECT_EQ("a", results[0].GetValue());
+  EXPECT_EQ(5, results[1].GetError<IoError>().code);
+  EXPECT_TRUE(results[2].IsEmpty());
+  EXPECT_EQ("b", results[3].GetValue());
+  EXPECT_EQ("bad", results[4].GetError<ParseError>().message);
+  EXPECT_EQ(&results.Values()[1], &results[3].GetValue());
+
+  const std::vector<std::string> values(results.Values().begin(), results.Values().end());
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), values);
+  EXPECT_EQ(1u, results.Errors<IoError>().size());
+  const ValueOrError<std::string, ParseError, IoError> io_error{MakeError<IoError>(5)};
+  EXPECT_EQ(io_error.LogicalIndex(), results.Indices()[1]);
+
+  size_t errors = 0;
+  for (ValueOrErrorRef<std::string, ParseError, IoError> ref : results) {
+    errors += ref.HasAnyError();
+  }
+  EXPECT_EQ(2u, errors);
+  EXPECT_EQ(2, std::ranges::count_if(results, [](auto ref) { return ref.HasValue(); }));
+
+  results.pop_back();
+  results.pop_back();
+  EXPECT_EQ(3u, results.size());
+  EXPECT_EQ(1u, results.Values().size());
+  EXPECT_TRUE(results.Errors<ParseError>().empty());
+
+  VoidOrErrorVector<IoError> statuses;
+  statuses.push_back(VoidOrError<IoError>{});
+  statuses.PushBackError(IoError{7});
+  EXPECT_FALSE(statuses[0].HasAnyError());
+  EXPECT_EQ(7, statuses[1].GetError<IoError>().code);
+
+  results.clear();
+  EXPECT_TRUE(results.empty());
+  EXPECT_TRUE(results.Values().empty());
+}
+
+TEST(ValueOrErrorVectorTest, Bool) {
+  ValueOrErrorVector<bool, IoError> results;
+  for (int i = 0; i < 20; ++i) {
+    if (i % 5 == 4) {
+      results.PushBackError(IoError{i});
+    } else {
+      results.emplace_back(i % 2 == 0);
+    }
+  }
+  results.push_back(ValueOrError<bool, IoError>{true});
+  ASSERT_EQ(21u, results.size());
+  EXPECT_TRUE(results[0].GetValue());
+  EXPECT_FALSE(results[1].GetValue());
+  EXPECT_EQ(9, results[9].GetError<IoError>().code);
+  EXPECT_TRUE(results[20].GetValue());
+  EXPECT_EQ(&results.Values()[1], &results[1].GetValue());
+
+  std::span<bool> values = results.Values();
+  ASSERT_EQ(17u, values.size());
+  values[0] = false;
+  EXPECT_FALSE(results[0].GetValue());
+  EXPECT_EQ(8, std::ranges::count(values, true));
+
+  auto copy = results;
+  const ValueOrErrorVector<bool, ParseError, IoError> moved(std::move(results));
+  EXPECT_TRUE(results.empty());
+  ASSERT_EQ(21u, moved.size());
+  EXPECT_TRUE(moved[20].GetValue());
+  copy.pop_back();
+  copy.pop_back();
+  EXPECT_EQ(19u, copy.size());
+  EXPECT_EQ(16u, copy.Values().size());
+  EXPECT_EQ(14, copy[14].GetError<IoError>().code);
+}
+
+TEST(ValueOrErrorVectorDeathTest, ValueIsStoredAsVoid) {
+  VoidOrErrorVector<IoError> statuses;
+  EXPECT_DEATH(statuses.push_back(ValueOrError<int, IoError>{1}), "trying to store a value");
+}
+
+
+template <typename Results>
+void ExpectBatchQueries(const Results& results, const std::vector<int>& kinds) {
+  size_t first_error = kinds.size();
+  std::array<size_t, 2> histogram{};
+  for (size_t i = kinds.size(); i-- > 0;) {
+    if (kinds[i] > 0) {
+      first_error = i;
+      ++histogram[kinds[i] - 1];
+    }
+  }
+  EXPECT_EQ(first_error, FindFirstError(results));
+  EXPECT_EQ(first_error == kinds.size(), AllOk(results));
+  EXPECT_EQ(histogram[0] + histogram[1], CountErrors(results));
+  EXPECT_EQ(histogram, ErrorHistogram(results));
+
+  std::vector<uint64_t> mask((kinds.size() + 63) / 64, ~uint64_t{0});
+  SuccessMask(results, mask);
+  for (size_t i = 0; i < mask.size() * 64; ++i) {
+    const bool success = i < kinds.size() && kinds[i] == 0;
+    EXPECT_EQ(success, (mask[i / 64] >> (i % 64)) & 1) << i;
+  }
+}
+
+TEST(BatchQueriesTest, Correctness) {
+  // 0 is a value, -1 is empty, 1 and 2 are the errors
+  for (size_t size : {0, 1, 31, 64, 100, 257, 1000}) {
+    for (size_t error_position : {size_t{0}, size / 2, size - 1, size}) {
+      std::vector<int> kinds(size);
+      for (size_t i = 0; i < size; ++i) {
+        kinds[i] = i % 7 == 3 ? -1 : i > error_position && i % 5 == 0 ? 1 + i % 2 : 0;
+      }
+      if (error_position < size) {
+        kinds[error_position] = 2;
+      }
+
+      std::vector<ValueOrError<std::string, ParseError, IoError>> array;
+      ValueOrErrorVector<std::string, ParseError, IoError> vector;
+      for (int kind : kinds) {
+        switch (kind) {
+          case -1: array.emplace_back(); break;
+          case 0: array.emplace_back(std::string("value")); break;
+          case 1: array.emplace_back(MakeError<ParseError>("bad")); break;
+          case 2: array.emplace_back(MakeError<IoError>(1)); break;
+        }
+        vector.push_back(array.back());
+      }
+      ExpectBatchQueries(array, kinds);
+      ExpectBatchQueries(std::span(array), kinds);
+      ExpectBatchQueries(vector, kinds);
+    }
+  }
+}
+
+TEST(BatchQueriesTest, Kernels) {
+  std::vector<detail_::ByteKernels> all_kernels{detail_::kScalarByteKernels};
+#if VOE_BATCH_SIMD
+  all_kernels.push_back(detail_::kSse2ByteKernels);
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    all_kernels.push_back(detail_::kAvx2ByteKernels);
+  }
+#endif
+  std::vector<uint8_t> data(300);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i * 37 % 11 == 0 ? 200 + i % 3 : i % 3);
+  }
+  for (size_t size = 0; size <= data.size(); ++size) {
+    std::vector<uint64_t> expected_mask((size + 63) / 64);
+    detail_::ScalarMaskEqual<uint8_t>(data.data(), size, 2, expected_mask.data());
+    for (const auto& kernels : all_kernels) {
+      EXPECT_EQ(
+          detail_::ScalarCountAtLeast<uint8_t>(data.data(), size, 200),
+          kernels.count_at_least(data.data(), size, 200));
+      EXPECT_EQ(
+          detail_::ScalarFindAtLeast<uint8_t>(data.data(), size, 201),
+          kernels.find_at_least(data.data(), size, 201));
+      EXPECT_EQ(
+          detail_::ScalarCountEqual<uint8_t>(data.data(), size, 1),
+          kernels.count_equal(data.data(), size, 1));
+      std::vector<uint64_t> mask(expected_mask.size());
+      kernels.mask_equal(data.data(), size, 2, mask.data());
+      EXPECT_EQ(expected_mask, mask);
+      const uint8_t table[16] = {3, 0, 1, 7, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15};
+      std::vector<uint8_t> remapped(size);
+      kernels.remap(data.data(), size, table, remapped.data());
+      for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(data[i] < 3 ? table[data[i]] : remapped[i], remapped[i]) << i;
+      }
+    }
+  }
+}
+
+TEST(VisitAllTest, GroupsByAlternative) {
+  std::vector<ValueOrError<int, ParseError, IoError>> array;
+  array.emplace_back(MakeError<IoError>(1));
+  array.emplace_back(10);
+  array.emplace_back(MakeError<ParseError>("bad"));
+  array.emplace_back(20);
+  array.emplace_back(MakeError<IoError>(2));
+  ValueOrErrorVector<int, ParseError, IoError> vector;
+  for (const auto& result : array) {
+    vector.push_back(result);
+  }
+
+  auto visitor = [](std::string& visited) {
+    return test::overloaded{
+      [&visited](int value) { visited += std::to_string(value) + ' '; },
+      [&visited](const ParseError& error) { visited += error.message + ' '; },
+      [&visited](const IoError& error) { visited += "io" + std::to_string(error.code) + ' '; },
+    };
+  };
+  std::string visited;
+  VisitAll(array, visitor(visited));
+  EXPECT_EQ("10 20 bad io1 io2 ", visited);
+  visited.clear();
+  VisitAll(std::as_const(vector), visitor(visited));
+  EXPECT_EQ("10 20 bad io1 io2 ", visited);
+
+  VisitAll(array, test::overloaded{[](int& value) { ++value; }, [](auto&) {}});
+  EXPECT_EQ(11, array[1].GetValue());
+
+  std::vector<size_t> positions;
+  auto record = [&positions](size_t position, const auto&) { positions.push_back(position); };
+  VisitAllIndexed(array, record);
+  EXPECT_EQ((std::vector<size_t>{1, 3, 2, 0, 4}), positions);
+  positions.clear();
+  VisitAllIndexed(vector, record);
+  EXPECT_EQ((std::vector<size_t>{1, 3, 2, 0, 4}), positions);
+}
+
+TEST(VisitAllTest, Void) {
+  std::vector<VoidOrError<IoError>> array(3);
+  array[1] = MakeError<IoError>(5);
+  VoidOrErrorVector<IoError> vector;
+  for (const auto& result : array) {
+    vector.push_back(result);
+  }
+
+  std::string visited;
+  auto visitor = test::overloaded{
+    [&visited]() { visited += "ok "; },
+    [&visited](const IoError& error) { visited += std::to_string(error.code) + ' '; },
+  };
+  VisitAll(array, visitor);
+  VisitAll(vector, visitor);
+  EXPECT_EQ("ok ok 5 ok ok 5 ", visited);
+
+  std::vector<size_t> positions;
+  VisitAllIndexed(vector, [&positions](size_t position, const auto&...) {
+    positions.push_back(position);
+  });
+  EXPECT_EQ((std::vector<size_t>{0, 2, 1}), positions);
+}
+
+TEST(VisitAllDeathTest, EmptyIsRejected) {
+  std::vector<ValueOrError<int, IoError>> array(2);
+  ValueOrErrorVector<int, IoError> vector;
+  vector.push_back(array[0]);
+  EXPECT_DEATH(VisitAll(array, [](auto&) {}), "range with empty objects");
+  EXPECT_DEATH(VisitAll(vector, [](auto&) {}), "range with empty objects");
+}
+
+TEST(ConvertAllTest, Trivial) {
+  std::vector<ValueOrError<int, IoError>> src(5);
+  src[0] = 1;
+  src[1] = MakeError<IoError>(2);
+  src[3] = 3;
+
+  std::vector<ValueOrError<int, Errno, IoError>> dst(5, MakeError<IoError>(9));
+  ConvertAll(src, dst);
+  EXPECT_EQ(1, dst[0].GetValue());
+  EXPECT_EQ(2, dst[1].GetError<IoError>().code);
+  EXPECT_TRUE(dst[2].IsEmpty());
+  EXPECT_EQ(3, dst[3].GetValue());
+  EXPECT_TRUE(dst[4].IsEmpty());
+
+  std::vector<VoidOrError<IoError>> statuses(2, MakeError<IoError>(9));
+  ConvertAll(std::span(src).subspan(1, 2), statuses);
+  EXPECT_EQ(2, statuses[0].GetError<IoError>().code);
+  EXPECT_FALSE(statuses[1].HasAnyError());
+}
+
+TEST(ConvertAllTest, Grouped) {
+  std::vector<ValueOrError<std::string, ParseError>> src;
+  src.emplace_back(MakeError<ParseError>("bad"));
+  src.emplace_back(std::string("a"));
+  src.emplace_back();
+  src.emplace_back(std::string("b"));
+
+  std::vector<ValueOrError<std::string, IoError, ParseError>> dst(4, std::string("old"));
+  ConvertAll(src, dst);
+  EXPECT_EQ("bad", dst[0].GetError<ParseError>().message);
+  EXPECT_EQ("a", dst[1].GetValue());
+  EXPECT_TRUE(dst[2].IsEmpty());
+  EXPECT_EQ("b", dst[3].GetValue());
+  EXPECT_EQ("a", src[1].GetValue());
+
+  ConvertAll(std::move(src), dst);
+  EXPECT_EQ("b", dst[3].GetValue());
+  EXPECT_TRUE(src[3].GetValue().empty());
+
+  std::vector<ValueOrError<Config, ParseError>> configs(1, Config{"old"});
+  ConvertAll(std::vector<ValueOrError<Config>>{Config{"new"}}, configs);
+  EXPECT_EQ("new", configs[0].GetValue().name);
+}
+
+TEST(ConvertAllTest, Vector) {
+  ValueOrErrorVector<std::string, ParseError> src;
+  src.EmplaceBackError<ParseError>("bad");
+  src.emplace_back("a");
+  src.push_back(ValueOrError<std::string, ParseError>{});
+  for (int i = 0; i < 100; ++i) {
+    src.emplace_back(std::to_string(i));
+  }
+
+  const ValueOrErrorVector<std::string, IoError, ParseError> dst(src);
+  ASSERT_EQ(src.size(), dst.size());
+  for (size_t i = 3; i < src.size(); ++i) {
+    EXPECT_EQ(src[i].GetValue(), dst[i].GetValue()) << i;
+  }
+  EXPECT_EQ("bad", dst[0].GetError<ParseError>().message);
+  EXPECT_TRUE(dst[2].IsEmpty());
+
+  const ValueOrErrorVector<std::string, IoError, ParseError> moved(std::move(src));
+  EXPECT_EQ("99", moved[102].GetValue());
+  EXPECT_TRUE(src.empty());
+  EXPECT_TRUE(src.begin() == src.end());
+  src.emplace_back("reused");
+  ASSERT_EQ(1u, src.size());
+  EXPECT_EQ("reused", src[0].GetValue());
+  src.pop_back();
+  EXPECT_TRUE(src.empty());
+
+  VoidOrErrorVector<IoError> statuses;
+  statuses.PushBackError(IoError{4});
+  statuses.push_back(VoidOrError<IoError>{});
+  const VoidOrErrorVector<ParseError, IoError> converted(statuses);
+  EXPECT_EQ(4, converted[0].GetError<IoError>().code);
+  EXPECT_FALSE(converted[1].HasAnyError());
+}
+
+TEST(ConvertAllDeathTest, ValueIsDropped) {
+  std::vector<ValueOrError<int, IoError>> src(1, 1);
+  std::vector<VoidOrError<IoError>> dst(1);
+  EXPECT_DEATH(ConvertAll(src, dst), "trying to drop a value");
+  std::vector<ValueOrError<std::string, IoError>> strings(1, std::string("a"));
+  EXPECT_DEATH(ConvertAll(strings, dst), "trying to drop a value");
+  EXPECT_DEATH(ConvertAll(src, std::vector<VoidOrError<IoError>>(2)), "of different sizes");
+
+  ValueOrErrorVector<int, IoError> vector;
+  vector.emplace_back(1);
+  EXPECT_DEATH(VoidOrErrorVector<IoError>{vector}, "trying to store a value");
+}
+
+TEST(PartitionTest, Correctness) {
+  for (size_t size : {0, 1, 64, 100, 257, 1000}) {
+    std::vector<ValueOrError<std::string, ParseError, IoError>> results;
+    std::vector<std::string> expected_values;
+    std::vector<size_t> expected_value_positions;
+    std::vector<size_t> expected_error_positions;
+    for (size_t i = 0; i < size; ++i) {
+      if (i % 7 == 3) {
+        results.emplace_back(MakeError<IoError>(static_cast<int>(i)));
+        expected_error_positions.push_back(i);
+      } else if (i % 11 == 5) {
+        results.emplace_back(MakeError<ParseError>("bad"));
+        expected_error_positions.push_back(i);
+      } else {
+        results.emplace_back(std::to_string(i));
+        expected_values.push_back(std::to_string(i));
+        expected_value_positions.push_back(i);
+      }
+    }
+
+    std::vector<std::string> values{"before"};
+    std::vector<VoidOrError<ParseError, IoError>> errors;
+    std::vector<size_t> value_positions;
+    std::vector<size_t> error_positions;
+    Partition(results, values, errors, value_positions, error_positions);
+    ASSERT_EQ(expected_values.size() + 1, values.size());
+    EXPECT_TRUE(std::equal(expected_values.begin(), expected_values.end(), values.begin() + 1));
+    EXPECT_EQ(expected_value_positions, value_positions);
+    EXPECT_EQ(expected_error_positions, error_positions);
+    ASSERT_EQ(error_positions.size(), errors.size());
+    for (size_t i = 0; i < errors.size(); ++i) {
+      EXPECT_EQ(results[error_positions[i]].GetErrorIndex(), errors[i].GetErrorIndex());
+    }
+
+    std::vector<std::string> compacted;
+    std::vector<size_t> positions;
+    CompactValues(std::span(results), compacted, positions);
+    EXPECT_EQ(expected_values, compacted);
+    EXPECT_EQ(expected_value_positions, positions);
+
+    compacted.clear();
+    CompactValues(std::move(results), compacted);
+    EXPECT_EQ(expected_values, compacted);
+  }
+}
+
+TEST(PartitionTest, TriviallyCopyable) {
+  std::vector<ValueOrError<long, ParseError, IoError>> results;
+  for (long i = 0; i < 200; ++i) {
+    if (i % 3 == 0) {
+      results.emplace_back(MakeError<IoError>(static_cast<int>(i)));
+    } else {
+      results.emplace_back(i);
+    }
+  }
+  std::vector<long> values;
+  std::vector<ValueOrError<void, IoError, ParseError>> errors;
+  std::vector<size_t> value_positions;
+  std::vector<size_t> error_positions;
+  Partition(results, values, errors, value_positions, error_positions);
+  ASSERT_EQ(133u, values.size());
+  ASSERT_EQ(67u, errors.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(static_cast<long>(value_positions[i]), values[i]);
+  }
+  for (size_t i = 0; i < errors.size(); ++i) {
+    EXPECT_EQ(3 * i, error_positions[i]);
+    EXPECT_EQ(static_cast<int>(3 * i), errors[i].GetError<IoError>().code);
+  }
+}
+
+TEST(PartitionDeathTest, EmptyIsRejected) {
+  std::vector<ValueOrError<int, IoError>> results(3, 1);
+  results[1].Clear();
+  std::vector<int> values;
+  std::vector<VoidOrError<IoError>> errors;
+  CompactValues(results, values);
+  EXPECT_EQ((std::vector<int>{1, 1}), values);
+  EXPECT_DEATH(Partition(results, values, errors), "range with empty objects");
+}
+
+TEST(ViewsTest, Adaptors) {
+  std::vector<ValueOrError<std::string, ParseError, IoError>> results;
+  results.emplace_back(std::string("a"));
+  results.emplace_back(MakeError<IoError>(1));
+  results.emplace_back(std::string("b"));
+  results.emplace_back(MakeError<ParseError>("bad"));
+  results.emplace_back();
+  results.emplace_back(std::string("c"));
+
+  std::string joined;
+  for (std::string& value : results | views::values) {
+    value += '!';
+    joined += value;
+  }
+  EXPECT_EQ("a!b!c!", joined);
+
+  std::vector<int> codes;
+  for (const IoError& error : results | views::errors<IoError>) {
+    codes.push_back(error.code);
+  }
+  EXPECT_EQ((std::vector<int>{1}), codes);
+
+  joined.clear();
+  for (const std::string& value : results | views::ok_or_stop) {
+    joined += value;
+  }
+  EXPECT_EQ("a!", joined);
+
+  auto parse = [](int i) -> ValueOrError<std::string, ParseError> {
+    if (i % 2 != 0) {
+      return MakeError<ParseError>(std::to_string(i));
+    }
+    return std::to_string(i);
+  };
+  joined.clear();
+  for (std::string value : std::views::iota(0, 5) | std::views::transform(parse) | views::values) {
+    joined += value;
+  }
+  EXPECT_EQ("024", joined);
+}
+
+TEST(ViewsTest, Collect) {
+  std::vector<ValueOrError<std::string, ParseError, IoError>> results;
+  results.emplace_back(std::string("a"));
+  results.emplace_back(std::string("b"));
+
+  auto collected = Collect(results);
+  static_assert(std::is_same_v<
+      ValueOrError<std::vector<std::string>, ParseError, IoError>, decltype(collected)>);
+  ASSERT_TRUE(collected.HasValue());
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), collected.GetValue());
+  EXPECT_EQ(2u, collected.GetValue().capacity());
+  EXPECT_EQ("a", results[0].GetValue());
+
+  results.emplace_back(MakeError<IoError>(3));
+  results.emplace_back(MakeError<ParseError>("bad"));
+  collected = Collect(std::move(results));
+  EXPECT_EQ(3, collected.GetError<IoError>().code);
+
+  std::vector<ValueOrError<int, IoError>> empties(2);
+  EXPECT_TRUE(Collect(empties).IsEmpty());
+
+  size_t calls = 0;
+  auto parse = [&calls](int i) -> ValueOrError<int, ParseError> {
+    ++calls;
+    if (i == 2) {
+      return MakeError<ParseError>("two");
+    }
+    return i;
+  };
+  const auto parsed = Collect(std::views::iota(0, 10) | std::views::transform(parse));
+  EXPECT_EQ("two", parsed.GetError<ParseError>().message);
+  EXPECT_EQ(3u, calls);
+}
+
+TEST(ErrorListTest, Accumulate) {
+  ErrorList<ParseError, IoError> errors;
+  EXPECT_TRUE(errors.empty());
+  EXPECT_FALSE(errors.Add(ValueOrError<int, IoError>(1)));
+  EXPECT_FALSE(errors.Add(VoidOrError<ParseError>()));
+  EXPECT_TRUE(errors.Add(MakeError<IoError>(1)));
+  EXPECT_FALSE(errors.HasError<ParseError>());
+  errors.EmplaceError<ParseError>("bad");
+  errors.EmplaceError<IoError>(3);
+  EXPECT_TRUE(errors.Add(ValueOrError<int, ParseError>(MakeError<ParseError>("worse"))));
+  errors.EmplaceError<IoError>(5);
+
+  ASSERT_EQ(5u, errors.size());
+  EXPECT_EQ(1, errors[0].GetError<IoError>().code);
+  EXPECT_EQ("bad", errors[1].GetError<ParseError>().message);
+  EXPECT_EQ(3, errors[2].GetError<IoError>().code);
+  EXPECT_EQ("worse", errors[3].GetError<ParseError>().message);
+  EXPECT_EQ(5, errors[4].GetError<IoError>().code);
+  EXPECT_TRUE(errors.HasError<ParseError>());
+  EXPECT_EQ(2, std::ranges::count_if(errors, [](const auto& error) {
+    return error.template HasError<ParseError>();
+  }));
+
+  const auto copy = errors;
+  EXPECT_EQ(5u, copy.size());
+  EXPECT_EQ(5, copy[4].GetError<IoError>().code);
+
+  errors.clear();
+  EXPECT_TRUE(errors.empty());
+  EXPECT_TRUE(errors.begin() == errors.end());
+  errors.EmplaceError<IoError>(7);
+  EXPECT_EQ(1u, errors.size());
+  EXPECT_EQ(7, errors[0].GetError<IoError>().code);
+}
+
+TEST(ErrorListTest, Combinators) {
+  auto check_name = [](const std::string& name) -> VoidOrError<ParseError> {
+    if (name.empty()) {
+      return MakeError<ParseError>("empty name");
+    }
+    return {};
+  };
+  auto check_length = [](const std::string& name) -> VoidOrError<IoError> {
+    if (name.size() > 3) {
+      return MakeError<IoError>(static_cast<int>(name.size()));
+    }
+    return {};
+  };
+
+  auto valid = CheckAll(std::string("abc"), check_name, check_length);
+  static_assert(std::is_same_v<
+      ValueOrError<std::string, ErrorList<ParseError, IoError>>, decltype(valid)>);
+  ASSERT_TRUE(valid.HasValue());
+  EXPECT_EQ("abc", valid.GetValue());
+
+  const auto invalid = CheckAll(std::string("abcd"), check_name, check_length, check_length);
+  ASSERT_TRUE(invalid.HasAnyError());
+  const auto& errors = invalid.GetError<ErrorList<ParseError, IoError>>();
+  ASSERT_EQ(2u, errors.size());
+  EXPECT_EQ(4, errors[1].GetError<IoError>().code);
+
+  auto collected = CollectErrors(check_name(""), check_length(""), MakeError<Status>("down"));
+  static_assert(std::is_same_v<ErrorList<ParseError, IoError, Status>, decltype(collected)>);
+  ASSERT_EQ(2u, collected.size());
+  EXPECT_EQ("empty name", collected[0].GetError<ParseError>().message);
+  EXPECT_EQ("down", collected[1].GetError<Status>().message);
+
+  const auto status = std::move(collected).IntoResult();
+  EXPECT_EQ(2u, (status.GetError<ErrorList<ParseError, IoError, Status>>().size()));
+  EXPECT_FALSE(CollectErrors(check_name("a")).IntoResult().HasAnyError());
+}
+
+// Counts the copies and moves of the object it was created as
+struct Tracked {
+  explicit Tracked(int* copies, int* moves) : copies(copies), moves(moves) {}
+  Tracked(const Tracked& other) : copies(other.copies), moves(other.moves) { ++*copies; }
+  Tracked(Tracked&& other) noexcept : copies(other.copies), moves(other.moves) { ++*moves; }
+
+  int* copies;
+  int* moves;
+};
+
+TEST(ZipTest, Correctness) {
+  int copies = 0;
+  int moves = 0;
+  ValueOrError<Tracked, ParseError> tracked(Tracked(&copies, &moves));
+  ValueOrError<std::string, IoError> name(std::string("name"));
+  ValueOrError<int, ParseError, Status> number(42);
+  copies = moves = 0;
+
+  auto zipped = Zip(std::move(tracked), name, std::move(number));
+  static_assert(std::is_same_v<
+      ValueOrError<std::tuple<Tracked, std::string, int>, IoError, ParseError, Status>,
+      decltype(zipped)>);
+  ASSERT_TRUE(zipped.HasValue());
+  EXPECT_EQ(0, copies);
+  EXPECT_EQ(1, moves);
+  EXPECT_EQ("name", std::get<1>(zipped.GetValue()));
+  EXPECT_EQ("name", name.GetValue());
+  EXPECT_EQ(42, std::get<2>(zipped.GetValue()));
+
+  const auto copied = Zip(std::as_const(zipped), name);
+  EXPECT_EQ(1, copies);
+  EXPECT_EQ("name", std::get<1>(std::get<0>(copied.GetValue())));
+
+  name = MakeError<IoError>(1);
+  number = MakeError<Status>("down");
+  auto failed = Zip(ValueOrError<int, ParseError>(1), name, number);
+  EXPECT_EQ(1, failed.GetError<IoError>().code);
+  failed = Zip(ValueOrError<int, ParseError>(MakeError<ParseError>("bad")), name, number);
+  EXPECT_EQ("bad", failed.GetError<ParseError>().message);
+  failed = Zip(ValueOrError<int, ParseError>(), name, number);
+  EXPECT_TRUE(failed.IsEmpty());
+  EXPECT_EQ("down", Zip(number).GetError<Status>().message);
+}
+
+TEST(ParallelTransformTest, Correctness) {
+  std::vector<int> inputs(1000);
+  std::iota(inputs.begin(), inputs.end(), 0);
+  auto parse = [](int input) -> ValueOrError<std::string, ParseError, IoError> {
+    if (input % 100 == 99) {
+      return MakeError<ParseError>(std::to_string(input));
+    }
+    return std::to_string(input);
+  };
+
+  const auto all =
+    ParallelTransform(inputs, parse, ParallelPolicy<>{.threads = 4, .chunk_size = 7});
+  static_assert(std::is_same_v<
+      const ValueOrError<std::vector<ValueOrError<std::string, ParseError, IoError>>>,
+      decltype(all)>);
+  ASSERT_TRUE(all.HasValue());
+  ASSERT_EQ(inputs.size(), all.GetValue().size());
+  for (int input : inputs) {
+    const auto& result = all.GetValue()[input];
+    if (input % 100 == 99) {
+      EXPECT_EQ(std::to_string(input), result.GetError<ParseError>().message);
+    } else {
+      EXPECT_EQ(std::to_string(input), result.GetValue());
+    }
+  }
+
+  EXPECT_TRUE(ParallelTransform(std::vector<int>{}, parse).GetValue().empty());
+}
+
+TEST(ParallelTransformTest, FatalError) {
+  std::vector<int> inputs(10000);
+  std::iota(inputs.begin(), inputs.end(), 0);
+  std::atomic<size_t> calls = 0;
+  auto check = [&calls](int input) -> ValueOrError<int, ParseError, IoError> {
+    ++calls;
+    if (input % 1000 == 500) {
+      return MakeError<IoError>(input);
+    }
+    if (input % 10 == 0) {
+      return MakeError<ParseError>("tens");
+    }
+    return input;
+  };
+
+  for (size_t threads : {1, 3, 8}) {
+    calls = 0;
+    const auto stopped = ParallelTransform(
+        inputs, check, ParallelPolicy<IoError>{.threads = threads, .chunk_size = 16});
+    EXPECT_EQ(500, stopped.GetError<IoError>().code);
+    if (threads == 1) {
+      EXPECT_EQ(501u, calls.load());
+    }
+  }
+
+  const auto kept = ParallelTransform(inputs, check, ParallelPolicy<ParseError>{.threads = 2});
+  EXPECT_EQ("tens", kept.GetError<ParseError>().message);
+
+  auto throwing = [](int input) -> ValueOrError<int, IoError> {
+    if (input == 1234) {
+      throw std::runtime_error("1234");
+    }
+    return input;
+  };
+  EXPECT_THROW(
+      (void)ParallelTransform(inputs, throwing, ParallelPolicy<>{.threads = 4}),
+      std::runtime_error);
+}
+
+struct Missing {};
+struct TooLong {};
+struct BadChar {};
+struct Duplicate {};
+struct Reserved {};
+
+using RowStatus = VoidOrError<Missing, TooLong, BadChar, Duplicate, Reserved>;
+
+// The status of a row: 0 is a success, and 1..5 are the errors in the order of RowStatus
+RowStatus MakeRowStatus(int kind) {
+  switch (kind) {
+    case 1: return MakeError<Missing>();
+    case 2: return MakeError<TooLong>();
+    case 3: return MakeError<BadChar>();
+    case 4: return MakeError<Duplicate>();
+    case 5: return MakeError<Reserved>();
+    default: return RowStatus{};
+  }
+}
+
+int RowStatusKind(const RowStatus& status) {
+  return status.HasAnyError() ? 1 + static_cast<int>(status.GetErrorIndex()) : 0;
+}
+
+TEST(StatusArrayTest, Correctness) {
+  for (size_t size : {0, 1, 63, 256, 257, 1000}) {
+    std::vector<int> kinds(size);
+    StatusArray<RowStatus> statuses;
+    for (size_t i = 0; i < size; ++i) {
+      kinds[i] = i % 9 == 4 ? 1 + i % 5 : 0;
+      statuses.push_back(MakeRowStatus(kinds[i]));
+    }
+    ASSERT_EQ(size, statuses.size());
+    for (size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(kinds[i], RowStatusKind(statuses[i])) << i;
+    }
+    EXPECT_EQ(kinds.size() - std::ranges::count(kinds, 0), statuses.CountErrors());
+    EXPECT_EQ(static_cast<size_t>(std::ranges::count(kinds, 3)), statuses.CountErrors<BadChar>());
+    EXPECT_EQ(
+        static_cast<size_t>(std::ranges::find(kinds, 5) - kinds.begin()),
+        statuses.FindError<Reserved>());
+    EXPECT_EQ(
+        static_cast<size_t>(std::ranges::find_if(kinds, [](int kind) { return kind != 0; })
+            - kinds.begin()),
+        statuses.FindFirstError());
+    EXPECT_EQ(size < 5, statuses.AllOk());
+  }
+
+  StatusArray<RowStatus> statuses(300);
+  statuses[299] = MakeError<Duplicate>();
+  statuses[10] = MakeError<TooLong>();
+  statuses[11] = statuses[10];
+  EXPECT_TRUE(std::as_const(statuses)[11].HasError<TooLong>());
+  const RowStatus status = statuses[299];
+  EXPECT_TRUE(status.HasError<Duplicate>());
+  EXPECT_EQ(3u, statuses.CountErrors());
+
+  // The removed errors are not counted once the array grows back
+  statuses.resize(200);
+  statuses.resize(300);
+  EXPECT_EQ(2u, statuses.CountErrors());
+  EXPECT_EQ(300u, statuses.FindError<Duplicate>());
+
+  std::vector<int> kinds;
+  for (const RowStatus& row : statuses) {
+    kinds.push_back(RowStatusKind(row));
+  }
+  EXPECT_EQ(300u, kinds.size());
+  EXPECT_EQ(2, kinds[11]);
+}
+
+TEST(StatusArrayTest, Merge) {
+  StatusArray<RowStatus> lhs(1000);
+  StatusArray<RowStatus> rhs(1000);
+  lhs[1] = MakeError<Missing>();
+  lhs[2] = MakeError<Reserved>();
+  rhs[2] = MakeError<BadChar>();
+  rhs[3] = MakeError<TooLong>();
+  rhs[999] = MakeError<Reserved>();
+  lhs.Merge(rhs);
+  EXPECT_EQ(4u, lhs.CountErrors());
+  EXPECT_TRUE(std::as_const(lhs)[1].HasError<Missing>());
+  EXPECT_TRUE(std::as_const(lhs)[2].HasError<Reserved>());
+  EXPECT_TRUE(std::as_const(lhs)[3].HasError<TooLong>());
+  EXPECT_TRUE(std::as_const(lhs)[999].HasError<Reserved>());
+  EXPECT_EQ(0u, lhs.CountErrors<BadChar>());
+}
+
+TEST(StatusArrayTest, Kernels) {
+  std::vector<detail_::PlaneKernels> all_kernels{detail_::kScalarPlaneKernels};
+#if VOE_BATCH_SIMD
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    all_kernels.push_back(detail_::kAvx2PlaneKernels);
+  }
+#endif
+  constexpr size_t planes = 3;
+  std::vector<uint64_t> words(4 * planes * detail_::kPlaneWords);
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = i % 5 == 0 ? 0 : (i + 1) * 0x9E3779B97F4A7C15;
+  }
+  for (size_t blocks = 0; blocks <= 4; ++blocks) {
+    for (size_t code : {size_t{0}, size_t{3}, size_t{7}, detail_::kAnyNonzeroCode}) {
+      size_t count = 0;
+      size_t first = blocks * detail_::kPlaneBlockRows;
+      for (size_t row = blocks * detail_::kPlaneBlockRows; row-- > 0;) {
+        const uint64_t* block = words.data() + row / 256 * planes * detail_::kPlaneWords;
+        size_t row_code = 0;
+        for (size_t plane = 0; plane < planes; ++plane) {
+          row_code |= ((block[plane * detail_::kPlaneWords + row % 256 / 64] >> row % 64) & 1)
+            << plane;
+        }
+        if (code == detail_::kAnyNonzeroCode ? row_code != 0 : row_code == code) {
+          ++count;
+          first = row;
+        }
+      }
+      for (const auto& kernels : all_kernels) {
+        EXPECT_EQ(count, kernels.count(words.data(), blocks, planes, code));
+        EXPECT_EQ(first, kernels.find(words.data(), blocks, planes, code));
+      }
+    }
+  }
+}
+
 }  // namespace voe
@@ -3,6 +3,16 @@
 #include <type_traits>
 
 #include "value_or_error.h"
+#include "voe/error_list.h"
+#include "voe/status_array.h"
+#include "voe/vector.h"
+#include "voe/views.h"
+#include "voe/zip.h"
+
+// All implementation layers must be explicitly instantiable, including for move-only types
+VOE_INSTANTIATE_TEMPLATE(std::unique_ptr<int>, char);
+VOE_INSTANTIATE_TEMPLATE(void, std::string);
+VOE_INSTANTIATE_TEMPLATE(void);
 
 namespace voe::detail_ {
 
@@ -137,6 +147,37 @@ TEST(RemoveDuplicatesTest, Correctness) {
         VariadicHolder<int, char, float>>);
 }
 
+template <size_t Index>
+struct Tag {};
+
+template <typename Sequence>
+struct TagsHolder;
+
+template <size_t... Indices>
+struct TagsHolder<std::index_sequence<Indices...>> {
+  using type = VariadicHolder<Tag<Indices>...>;
+  using doubled = VariadicHolder<Tag<Indices>..., Tag<Indices>...>;
+
+  static_assert(AllUnique<Tag<Indices>...>);
+  static_assert(!AllUnique<Tag<Indices>..., Tag<0>>);
+  static_assert(
+    TypeToIndex<Tag<sizeof...(Indices) - 1>, Tag<Indices>...> == sizeof...(Indices) - 1);
+  static_assert(
+    std::is_same_v<
+        IndexToType<sizeof...(Indices) - 1, Tag<Indices>...>,
+        Tag<sizeof...(Indices) - 1>>);
+};
+
+TEST(LargePackTest, Correctness) {
+  using Tags = TagsHolder<std::make_index_sequence<500>>;
+  static_assert(std::is_same_v<RemoveDuplicates<Tags::doubled>, Tags::type>);
+  static_assert(
+    std::is_same_v<
+        RemoveTypes<Tags::doubled, Tag<0>>,
+        RemoveTypes<Tags::doubled, Tag<0>, Tag<0>>>);
+  static_assert(std::is_same_v<Union<Tags::type, Tags::doubled, Tags::type>, Tags::type>);
+}
+
 TEST(UnionTest, Correctness) {
   static_assert(std::is_same_v<Union<>, VariadicHolder<>>);
   static_assert(std::is_same_v<Union<VariadicHolder<>>, VariadicHolder<>>);
@@ -211,6 +252,114 @@ TEST(VoEUnionTest, Correctness) {
         ValueOrError<void, char, int, std::string, int64_t, short>>);
 }
 
+TEST(FlatTest, Correctness) {
+  static_assert(std::is_same_v<voe::Flat<ValueOrError<int>>, ValueOrError<int>>);
+  static_assert(std::is_same_v<voe::Flat<ValueOrError<int, char>>, ValueOrError<int, char>>);
+  static_assert(
+    std::is_same_v<
+        voe::Flat<ValueOrError<ValueOrError<int, char>, short>>,
+        ValueOrError<int, char, short>>);
+  static_assert(
+    std::is_same_v<
+        voe::Flat<ValueOrError<ValueOrError<int, char, short>, short, long>>,
+        ValueOrError<int, char, short, long>>);
+  static_assert(
+    std::is_same_v<
+        voe::Flat<ValueOrError<ValueOrError<ValueOrError<int, char>, short>, char, long>>,
+        ValueOrError<int, short, char, long>>);
+  static_assert(
+    std::is_same_v<
+        voe::Flat<ValueOrError<VoidOrError<char>, short>>,
+        VoidOrError<char, short>>);
+}
+
+TEST(CanonicalTest, Correctness) {
+  static_assert(std::is_same_v<voe::Canonical<ValueOrError<int>>, ValueOrError<int>>);
+  static_assert(
+    std::is_same_v<
+        voe::Canonical<ValueOrError<int, char, short>>,
+        voe::Canonical<ValueOrError<int, short, char>>>);
+  static_assert(
+    std::is_same_v<
+        voe::Canonical<VoidOrError<char, std::string, short>>,
+        voe::Canonical<VoidOrError<short, char, std::string>>>);
+  static_assert(
+    std::is_same_v<
+        voe::Canonical<voe::Canonical<ValueOrError<int, long, char, short>>>,
+        voe::Canonical<ValueOrError<int, long, char, short>>>);
+  static_assert(
+    std::is_same_v<
+        voe::CanonicalUnion<float, ValueOrError<int, char>, VoidOrError<short, char>>,
+        voe::CanonicalUnion<float, short, ValueOrError<void, char>>>);
+  static_assert(
+    std::is_same_v<
+        voe::CanonicalUnion<float, char, short>,
+        voe::Canonical<voe::Union<float, short, char>>>);
+
+  static_assert(CanonicalOrderHolder<VariadicHolder<char, short, char>>::UniqueKeys);
+#if defined(__GNUC__) && !defined(__clang__)
+  // GCC spells both local classes as TestBody()::<lambda()>::Local
+  auto first = [] { struct Local {}; return Local{}; };
+  auto second = [] { struct Local {}; return Local{}; };
+  static_assert(
+    !CanonicalOrderHolder<VariadicHolder<decltype(first()), decltype(second())>>::UniqueKeys);
+#endif
+}
+
+struct Retryable {};
+struct Fatal {};
+struct Timeout { using ErrorCategory = Retryable; };
+struct Unavailable { using ErrorCategory = Retryable; };
+struct Corrupted { using ErrorCategory = Fatal; };
+
+TEST(CategorizedTest, Correctness) {
+  static_assert(std::is_same_v<voe::Categorized<ValueOrError<int>>, ValueOrError<int>>);
+  static_assert(
+    std::is_same_v<
+        voe::Categorized<ValueOrError<int, char, short>>,
+        ValueOrError<int, char, short>>);
+  static_assert(
+    std::is_same_v<
+        voe::Categorized<ValueOrError<int, Timeout, char, Unavailable>>,
+        ValueOrError<int, Timeout, Unavailable, char>>);
+  static_assert(
+    std::is_same_v<
+        voe::Categorized<VoidOrError<char, Timeout, Corrupted, short, Unavailable>>,
+        VoidOrError<char, short, Timeout, Unavailable, Corrupted>>);
+  static_assert(
+    std::is_same_v<
+        voe::Canonical<ValueOrError<int, Timeout, char, Unavailable>>,
+        voe::Canonical<ValueOrError<int, Unavailable, char, Timeout>>>);
+}
+
+TEST(IndexSetTest, Correctness) {
+  constexpr auto contiguous = [] {
+    IndexSet<8> set;
+    set.Insert(3);
+    set.Insert(2);
+    set.Insert(3);
+    return set;
+  }();
+  static_assert(contiguous.count == 2 && contiguous.Contiguous());
+  static_assert(!InIndexSet<8, contiguous>(1));
+  static_assert(InIndexSet<8, contiguous>(2));
+  static_assert(InIndexSet<8, contiguous>(3));
+  static_assert(!InIndexSet<8, contiguous>(4));
+
+  constexpr auto sparse = [] {
+    IndexSet<130> set;
+    set.Insert(1);
+    set.Insert(129);
+    return set;
+  }();
+  static_assert(!sparse.Contiguous());
+  static_assert(InIndexSet<130, sparse>(1));
+  static_assert(!InIndexSet<130, sparse>(64));
+  static_assert(InIndexSet<130, sparse>(129));
+
+  static_assert(!InIndexSet<8, IndexSet<8>{}>(0));
+}
+
 TEST(SubsetOfTest, Correctness) {
   static_assert(SubsetOf<VariadicHolder<>, VariadicHolder<>>::value);
   static_assert(SubsetOf<VariadicHolder<>, VariadicHolder<int>>::value);
@@ -328,11 +477,109 @@ TEST(ValueOrError, TriviallyDestructible) {
   static_assert(!std::is_trivially_destructible_v<ValueOrError<int, std::unique_ptr<int>>>);
 }
 
+TEST(ValueOrError, CopyableIfAlternativesAre) {
+  using MoveOnly = ValueOrError<std::unique_ptr<int>, char>;
+  static_assert(!std::is_copy_constructible_v<MoveOnly>);
+  static_assert(!std::is_copy_assignable_v<MoveOnly>);
+  static_assert(std::is_move_constructible_v<MoveOnly>);
+  static_assert(std::is_move_assignable_v<MoveOnly>);
+  static_assert(!std::is_copy_constructible_v<VoidOrError<std::unique_ptr<int>>>);
+  static_assert(std::is_copy_constructible_v<ValueOrError<std::string, int>>);
+  static_assert(std::is_copy_assignable_v<VoidOrError<std::string>>);
+}
+
+TEST(ValueOrError, InPlaceIndexConstructorIsPrivate) {
+  static_assert(!std::is_constructible_v<ValueOrError<int, char>, InPlaceIndexTag<1>, char>);
+  static_assert(
+      InPlaceFactory::Make<ValueOrError<int, char>, 1>('a').GetError<char>() == 'a');
+}
+
 TEST(ValueConstructorTest, Nothrow) {
   static_assert(std::is_nothrow_constructible_v<ValueOrError<int>, int>);
   static_assert(!std::is_nothrow_constructible_v<ValueOrError<std::string>, std::string>);
 }
 
+TEST(ValueOrErrorRefTest, Layout) {
+  static_assert(sizeof(ValueOrErrorRef<int>) <= 2 * sizeof(void*));
+  static_assert(sizeof(ValueOrErrorRef<std::string, int, float>) <= 2 * sizeof(void*));
+  static_assert(sizeof(VoidOrErrorRef<std::string, int, float>) <= 2 * sizeof(void*));
+  static_assert(std::is_trivially_copyable_v<ValueOrErrorRef<std::string, std::string>>);
+}
+
+TEST(ValueOrErrorRefTest, Constructible) {
+  static_assert(std::is_constructible_v<ValueOrErrorRef<int, char>, ValueOrError<int, char>&>);
+  static_assert(std::is_constructible_v<ValueOrErrorRef<int, char>, const ValueOrError<int>&>);
+  static_assert(
+    std::is_constructible_v<ValueOrErrorRef<int, char, short>, ValueOrError<int, short>>);
+  static_assert(std::is_constructible_v<ValueOrErrorRef<int, char>, VoidOrError<char>&>);
+  static_assert(std::is_constructible_v<VoidOrErrorRef<char>, ValueOrError<int, char>&>);
+  static_assert(!std::is_constructible_v<ValueOrErrorRef<int, char>, ValueOrError<int, short>&>);
+  static_assert(!std::is_constructible_v<ValueOrErrorRef<int, char>, ValueOrError<float, char>&>);
+}
+
+TEST(ValueOrErrorVectorTest, Range) {
+  using Vector = ValueOrErrorVector<std::string, int, float>;
+  static_assert(std::ranges::random_access_range<const Vector>);
+  static_assert(std::ranges::sized_range<const Vector>);
+  static_assert(std::is_same_v<uint8_t, Vector::IndexType>);
+
+  constexpr auto pushable = [](auto&& voe) {
+    return requires(ValueOrErrorVector<int, char>& vector) { vector.push_back(voe); };
+  };
+  static_assert(pushable(ValueOrError<int, char>{}) && pushable(VoidOrError<char>{}));
+  static_assert(!pushable(ValueOrError<int, short>{}) && !pushable(ValueOrError<long, char>{}));
+}
+
+TEST(ViewsTest, References) {
+  using Results = std::vector<ValueOrError<std::string, int>>;
+  using Values = decltype(std::declval<Results&>() | views::values);
+  using Errors = decltype(std::declval<Results&>() | views::errors<int>);
+  static_assert(std::is_same_v<std::string&, std::ranges::range_reference_t<Values>>);
+  static_assert(std::is_same_v<int&, std::ranges::range_reference_t<Errors>>);
+  static_assert(std::ranges::view<decltype(std::declval<Results&>() | views::ok_or_stop)>);
+
+  auto make = [](int i) { return ValueOrError<std::string, int>(std::to_string(i)); };
+  using Prvalues = decltype(std::views::iota(0, 1) | std::views::transform(make));
+  using MovedValues = decltype(std::declval<Prvalues>() | views::values);
+  static_assert(std::is_same_v<std::string, std::ranges::range_reference_t<MovedValues>>);
+}
+
+struct TagA {};
+struct TagB {};
+
+TEST(ErrorListTest, Types) {
+  using Errors = ErrorList<TagA, int>;
+  static_assert(std::ranges::random_access_range<const Errors>);
+  static_assert(
+      std::is_same_v<const VoidOrError<TagA, int>&, std::ranges::range_reference_t<Errors>>);
+
+  auto check_int = [](int) { return VoidOrError<int>(); };
+  auto check_tag = [](int) { return VoidOrError<TagA, long>(); };
+  static_assert(std::is_same_v<
+      ValueOrError<int, ErrorList<int, TagA, long>>, decltype(CheckAll(1, check_int, check_tag))>);
+}
+
+TEST(ZipTest, Constexpr) {
+  constexpr auto zipped = Zip(ValueOrError<int, char>(1), ValueOrError<long, short, char>(2L));
+  static_assert(
+      std::is_same_v<const ValueOrError<std::tuple<int, long>, short, char>, decltype(zipped)>);
+  static_assert(std::get<1>(zipped.GetValue()) == 2L);
+  static_assert(
+      Zip(ValueOrError<int, char>(1), ValueOrError<long, short>(MakeError<short>(3)))
+        .GetError<short>() == 3);
+}
+
+template <typename Status>
+concept PackableStatus = requires { typename StatusArray<Status>::value_type; };
+
+TEST(StatusArrayTest, Range) {
+  using Statuses = StatusArray<VoidOrError<TagA, TagB>>;
+  static_assert(std::ranges::random_access_range<const Statuses>);
+  static_assert(std::is_same_v<VoidOrError<TagA, TagB>, std::ranges::range_value_t<Statuses>>);
+  static_assert(PackableStatus<VoidOrError<TagA>>);
+  static_assert(!PackableStatus<VoidOrError<int>> && !PackableStatus<ValueOrError<int, TagA>>);
+}
+
 ValueOrError<int, const char*> ReturnValue() {
   return 42;
 }
@@ -361,5 +608,134 @@ TEST(GetValueTest, RefQualifiers) {
   }
 }
 
+// Owns heap memory, so that any leaked or double-destroyed alternative fails constant evaluation
+struct ConstexprBox {
+  constexpr explicit ConstexprBox(int value) : ptr(new int(value)) {}
+  constexpr ConstexprBox(const ConstexprBox& other) : ptr(new int(*other.ptr)) {}
+  constexpr ConstexprBox(ConstexprBox&& other) noexcept : ptr(other.ptr) { other.ptr = nullptr; }
+  constexpr ConstexprBox& operator=(const ConstexprBox& other) {
+    *ptr = *other.ptr;
+    return *this;
+  }
+  constexpr ConstexprBox& operator=(ConstexprBox&& other) noexcept {
+    std::swap(ptr, other.ptr);
+    return *this;
+  }
+  constexpr ~ConstexprBox() { delete ptr; }
+
+  int* ptr;
+};
+
+struct ConstexprError {
+  int code;
+};
+
+constexpr ValueOrError<ConstexprBox, ConstexprError, char> ConstexprParse(int input) {
+  if (input < 0) {
+    return MakeError<ConstexprError>(input);
+  }
+  if (input == 0) {
+    return MakeError<char>('0');
+  }
+  return ConstexprBox(input);
+}
+
+constexpr ValueOrError<int, ConstexprError, char> ConstexprDouble(int input) {
+  ConstexprBox box(0);
+  ASSIGN_OR_RETURN_ERROR(box, ConstexprParse(input));
+  return *box.ptr * 2;
+}
+
+constexpr VoidOrError<ConstexprError, char> ConstexprCheck(int input) {
+  RETURN_IF_ERROR(ConstexprDouble(input));
+  return {};
+}
+
+struct ConstexprVisitor {
+  constexpr int operator()(const ConstexprBox& box) const { return *box.ptr; }
+  constexpr int operator()(const ConstexprError& error) const { return error.code; }
+  constexpr int operator()(char c) const { return c; }
+};
+
+TEST(ConstexprTest, ConstructAndGet) {
+  static_assert(ValueOrError<int>().IsEmpty());
+  static_assert(ValueOrError<int>(42).GetValue() == 42);
+  static_assert(*ConstexprParse(7).GetValue().ptr == 7);
+  static_assert(ConstexprParse(-3).GetError<ConstexprError>().code == -3);
+  static_assert(ConstexprParse(0).GetError<1>() == '0');
+  static_assert(ConstexprParse(0).GetErrorIndex() == 1);
+  static_assert(MakeError<char>('e').HasError<char>());
+}
+
+TEST(ConstexprTest, CopyMoveAndAssign) {
+  static_assert([] {
+    auto voe = ConstexprParse(5);
+    auto copy = voe;
+    auto moved = std::move(voe);
+    copy = ConstexprParse(-1);
+    moved = copy;
+    voe = ConstexprParse(9);
+    return moved.GetError<ConstexprError>().code == -1 && *voe.GetValue().ptr == 9;
+  }());
+}
+
+TEST(ConstexprTest, Conversions) {
+  static_assert([] {
+    ValueOrError<ConstexprBox, ConstexprError, char, short> wide = ConstexprParse(4);
+    ValueOrError<ConstexprBox, char, ConstexprError> narrow = ConstexprParse(0);
+    wide = narrow;
+    VoidOrError<char, ConstexprError> errors = ConstexprParse(-2).DiscardValue();
+    auto kept = ConstexprParse(0).DiscardErrors<char>();
+    return wide.GetError<char>() == '0' &&
+           errors.GetError<ConstexprError>().code == -2 &&
+           std::is_same_v<decltype(kept), ValueOrError<ConstexprBox, ConstexprError>> &&
+           kept.IsEmpty();
+  }());
+}
+
+TEST(ConstexprTest, Visit) {
+  static_assert(ConstexprParse(11).Visit(ConstexprVisitor{}) == 11);
+  static_assert(ConstexprParse(-5).Visit(ConstexprVisitor{}) == -5);
+  static_assert(ConstexprParse(0).Visit(ConstexprVisitor{}) == '0');
+  static_assert(VoidOrError<char>().Visit([](auto... c) { return sizeof...(c); }) == 0);
+}
+
+TEST(ConstexprTest, Monadic) {
+  static_assert(
+      ConstexprParse(3).Transform([](ConstexprBox&& box) { return *box.ptr + 1; }).GetValue() == 4);
+  static_assert(
+      ConstexprParse(-1)
+        .TransformError([](auto&& error) {
+          if constexpr (std::is_same_v<std::remove_cvref_t<decltype(error)>, char>) {
+            return error;
+          } else {
+            return static_cast<char>('a' - error.code);
+          }
+        })
+        .GetError<char>() == 'b');
+}
+
+TEST(ConstexprTest, PropagationMacros) {
+  static_assert(ConstexprDouble(21).GetValue() == 42);
+  static_assert(ConstexprDouble(-7).GetError<ConstexprError>().code == -7);
+  static_assert(!ConstexprCheck(1).HasAnyError());
+  static_assert(ConstexprCheck(0).GetError<char>() == '0');
+}
+
+consteval int ConstevalDouble(int input) {
+  return ConstexprDouble(input).Visit([](auto value) {
+    if constexpr (std::is_same_v<decltype(value), int>) {
+      return value;
+    } else {
+      return -1;
+    }
+  });
+}
+
+TEST(ConstexprTest, Consteval) {
+  static_assert(ConstevalDouble(8) == 16);
+  static_assert(ConstevalDouble(0) == -1);
+}
+
 }  // namespace voe::detail_
 
@@ -9,8 +9,7 @@
 
 namespace voe {
 
-template <typename... Ts> struct overloaded : Ts... { using Ts::operator()...; };
-template <typename... Ts> overloaded(Ts...) -> overloaded<Ts...>;
+using test::overloaded;
 
 template <typename ValueType, typename VisitType, typename... ErrorTypes>
 struct VisitChecker {
@@ -440,5 +439,136 @@ TEST(AssignmentsTest, CorrectTypeAndOperation) {
   test::InstantiateAndCall<AssignmentsTest>(Types{});
 }
 
-}  // namespace voe
+TEST(MonadicTest, ErrorIsMovedThroughChain) {
+  using V = test::RememberLastOp<0>;
+  using E = test::RememberLastOp<1>;
+
+  ValueOrError<V, E> voe{MakeError<E>()};
+  test::OpCollector collector;
+  auto result = std::move(voe)
+    .Transform([](V&&) { ADD_FAILURE(); return 0; })
+    .AndThen([](int) -> ValueOrError<V, E> { ADD_FAILURE(); return V{}; })
+    .OrElse([](E&& e) { return MakeError<E>(std::move(e)); });
+
+  static_assert(std::is_same_v<decltype(result), ValueOrError<V, E>>);
+  EXPECT_TRUE(result.HasError<E>());
+  EXPECT_TRUE(collector.Equal(
+      test::Op(test::CONSTRUCT_MOVE, E::Idx),  // Transform
+      test::Op(test::CONSTRUCT_MOVE, E::Idx),  // AndThen
+      test::Op(test::CONSTRUCT_MOVE, E::Idx),  // MakeError
+      test::Op(test::CONSTRUCT_MOVE, E::Idx),  // OrElse
+      test::Op(test::Destroy, E::Idx),
+      test::Op(test::Destroy, E::Idx),
+      test::Op(test::Destroy, E::Idx)));
+}
+
+TEST(MonadicTest, ValueIsMovedThroughChain) {
+  using V = test::RememberLastOp<0>;
+  using E = test::RememberLastOp<1>;
+
+  ValueOrError<V, E> voe{V{}};
+  test::OpCollector collector;
+  auto result = std::move(voe)
+    .AndThen([](V&& v) -> ValueOrError<V, E> { return std::move(v); })
+    .TransformError([](E&&) { ADD_FAILURE(); return 0; });
+
+  static_assert(std::is_same_v<decltype(result), ValueOrError<V, int>>);
+  EXPECT_TRUE(result.HasValue());
+  EXPECT_TRUE(collector.Equal(
+      test::Op(test::CONSTRUCT_MOVE, V::Idx),  // callable result
+      test::Op(test::CONSTRUCT_MOVE, V::Idx),  // AndThen
+      test::Op(test::Destroy, V::Idx),
+      test::Op(test::CONSTRUCT_MOVE, V::Idx),  // TransformError
+      test::Op(test::Destroy, V::Idx)));
+}
+
+TEST(MonadicTest, ConstChainCopies) {
+  using V = test::RememberLastOp<0>;
+  using E = test::RememberLastOp<1>;
+
+  const ValueOrError<V, E> voe{MakeError<E>()};
+  test::OpCollector collector;
+  auto result = voe.Transform([](const V&) { ADD_FAILURE(); return 0; });
+
+  EXPECT_TRUE(result.HasError<E>());
+  EXPECT_TRUE(collector.Equal(test::Op(test::CONSTRUCT_COPY_CONST, E::Idx)));
+}
+
+TEST(PipelineTest, ErrorIsMovedOnce) {
+  using V = test::RememberLastOp<0>;
+  using E = test::RememberLastOp<1>;
 
+  auto pipeline = Pipe(
+      [](int) -> ValueOrError<int, E> { return 1; },
+      [](int) -> ValueOrError<V, E> { return MakeError<E>(); },
+      [](V&&) -> ValueOrError<int, E> { ADD_FAILURE(); return 1; });
+
+  test::OpCollector collector;
+  {
+    auto result = pipeline(0);
+    EXPECT_TRUE(result.HasError<E>());
+  }
+  EXPECT_TRUE(collector.Equal(
+      test::Op(test::Create, E::Idx),          // MakeError
+      test::Op(test::CONSTRUCT_MOVE, E::Idx),  // step result conversion
+      test::Op(test::Destroy, E::Idx),
+      test::Op(test::CONSTRUCT_MOVE, E::Idx),  // pipeline result
+      test::Op(test::Destroy, E::Idx),
+      test::Op(test::Destroy, E::Idx)));
+}
+
+TEST(FlattenTest, InnerPayloadIsMovedOnce) {
+  using V = test::RememberLastOp<0>;
+  using E = test::RememberLastOp<1>;
+  using Nested = ValueOrError<ValueOrError<ValueOrError<V, E>, char>, short>;
+
+  Nested nested{ValueOrError<ValueOrError<V, E>, char>{ValueOrError<V, E>{V{}}}};
+  {
+    test::OpCollector collector;
+    auto flat = std::move(nested).Flatten();
+    static_assert(std::is_same_v<decltype(flat), ValueOrError<V, E, char, short>>);
+    EXPECT_TRUE(flat.HasValue());
+    EXPECT_TRUE(collector.Equal(test::Op(test::CONSTRUCT_MOVE, V::Idx)));
+  }
+
+  Nested error{ValueOrError<ValueOrError<V, E>, char>{ValueOrError<V, E>{MakeError<E>()}}};
+  {
+    test::OpCollector collector;
+    auto flat = std::move(error).Flatten();
+    EXPECT_TRUE(flat.HasError<E>());
+    EXPECT_TRUE(collector.Equal(test::Op(test::CONSTRUCT_MOVE, E::Idx)));
+  }
+}
+
+TEST(MapErrorsTest, ErrorIsMovedOnce) {
+  using V = test::RememberLastOp<0>;
+  using E1 = test::RememberLastOp<1>;
+  using E2 = test::RememberLastOp<2>;
+  struct Wrapped {
+    explicit Wrapped(E1&& e) : inner(std::move(e)) {}
+    E1 inner;
+  };
+
+  struct Translator {
+    static std::type_identity<Wrapped> Translate(E1&&);
+  };
+
+  {
+    ValueOrError<V, E1> voe{MakeError<E1>()};
+    test::OpCollector collector;
+    auto result = std::move(voe).MapErrors<Translator>();
+    static_assert(std::is_same_v<decltype(result), ValueOrError<V, Wrapped>>);
+    EXPECT_TRUE(result.HasError<Wrapped>());
+    EXPECT_TRUE(collector.Equal(test::Op(test::CONSTRUCT_MOVE, E1::Idx)));
+  }
+  {
+    ValueOrError<V, E1, E2> voe{MakeError<E2>()};
+    test::OpCollector collector;
+    auto result = std::move(voe).MapErrors<Translator>();
+    static_assert(std::is_same_v<decltype(result), ValueOrError<V, Wrapped, E2>>);
+    EXPECT_TRUE(result.HasError<E2>());
+    EXPECT_TRUE(collector.Equal(test::Op(test::CONSTRUCT_MOVE, E2::Idx)));
+  }
+}
+
+}  // namespace voe
@@ -5,6 +5,9 @@
 
 namespace test {
 
+template <typename... Ts> struct overloaded : Ts... { using Ts::operator()...; };
+template <typename... Ts> overloaded(Ts...) -> overloaded<Ts...>;
+
 template <typename...>
 struct Ts {};
 
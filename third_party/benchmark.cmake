@@ -0,0 +1,15 @@
+find_package(benchmark QUIET)
+
+if (NOT benchmark_FOUND)
+  FetchContent_Declare(
+    benchmark
+    URL https://github.com/google/benchmark/archive/refs/tags/v1.8.3.zip
+    GIT_SHALLOW TRUE
+    GIT_PROGRESS TRUE
+  )
+
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+
+  FetchContent_MakeAvailable(benchmark)
+endif()
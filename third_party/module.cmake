@@ -3,4 +3,5 @@ include(FetchContent)
 set(FETCHCONTENT_QUIET FALSE)
 
 include(third_party/gtest.cmake)
+include(third_party/benchmark.cmake)
 include(third_party/doxygen.cmake)